@@ -27,6 +27,21 @@
 
 void CanIf_TxConfirmation(PduIdType CanTxPduId);
 
+/**
+ * \brief This callback function is called when a pending L-PDU was removed from
+ *  its hardware object to let a higher priority L-PDU be transmitted.
+ *  PduInfoPtr gives back the data of the cancelled L-PDU.
+ */
+void CanIf_CancelTxConfirmation(PduIdType CanTxPduId, const PduInfoType * PduInfoPtr);
+
+/**
+ * \brief This callback function is called when an L-PDU given with a NULL_PTR
+ *  sdu gets a hardware object. The upper layer copies the data to
+ *  PduInfoPtr->SduDataPtr, at most PduInfoPtr->SduLength bytes, and updates
+ *  SduLength. E_NOT_OK means that no data is available.
+ */
+Std_ReturnType CanIf_TriggerTransmit(PduIdType TxPduId, PduInfoType * PduInfoPtr);
+
 /*apply the cnhages */
 void CanIf_ControllerModeIndication( uint8 ControllerId, Can_ControllerStateType ControllerMode );
 void CanIf_ControllerBusOff(uint8 ControllerId);
@@ -40,5 +55,32 @@ extern void CanIf_RxIndication
     const PduInfoType * PduInfoPtr
 );
 
+/**
+ * \brief Same as CanIf_TxConfirmation, TimeStamp gives the core clock cycles of
+ *  syst when the driver saw the transmission complete.
+ */
+void CanIf_TxConfirmationTimeStamp(PduIdType CanTxPduId, uint64 TimeStamp);
+
+/**
+ * \brief Same as CanIf_RxIndication, TimeStamp gives the core clock cycles of
+ *  syst when the driver was interrupted by the reception, or when it polled it.
+ */
+void CanIf_RxIndicationTimeStamp
+(
+    const Can_HwType * Mailbox,
+    const PduInfoType * PduInfoPtr,
+    uint64 TimeStamp
+);
+
+/**
+ * \brief This callout function is called instead of CanIf_RxIndication with all
+ *  the frames the driver found in one scan, in their order of reception. The
+ *  Frames array is only valid during the call. With CanRxBufferLoan STD_OFF the
+ *  data is only valid during the call too. With CanRxBufferLoan STD_ON the data
+ *  of each frame is in a buffer lent to the upper layer, it stays valid until
+ *  Frames[i].PduInfo.SduDataPtr is given to Can_ReleaseRxBuffer, which shall be
+ *  done for every frame of the batch.
+ */
+void CanIf_RxIndicationBatch(const Can_RxFrame * Frames, uint8 Count);
 
 #endif //__CANIF_CBK_H__
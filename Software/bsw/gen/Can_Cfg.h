@@ -43,20 +43,33 @@
 
 #define MAX_BAUDRATE_CONFIGS_CONTROLLER_0 	     (1U)
 #define MAX_BAUDRATE_CONFIGS_CONTROLLER_1	     (1U)
-#define USED_CONTROLLERS_NUMBER                  (1U)                /*number of can controllers in the ECU*/
-#define CAN_HOH_NUMBER                           (2U)
+#define USED_CONTROLLERS_NUMBER                  (2U)                /*number of can controllers in the ECU*/
+/* Builds the write benchmark configuration of Can_PBcfg.c instead of the demo one: CAN0
+ * gets 31 HTHs of one message object each and one HRH, which fill its 32 message objects,
+ * for Test4_Write_Benchmark of the CCS application */
+#define CanWriteBenchmarkConfig                  STD_OFF
+#if (CanWriteBenchmarkConfig == STD_ON)
+#define CAN_HOH_NUMBER                           (32U)
 #define CAN_HRH_NUMBER                           (1U)
-#define CAN_HTH_NUMBER                           (1U)
+#define CAN_HTH_NUMBER                           (31U)
+#else
+#define CAN_HOH_NUMBER                           (6U)
+#define CAN_HRH_NUMBER                           (3U)
+#define CAN_HTH_NUMBER                           (3U)
+#endif
 #define CLOCK                                    (80000000)            /*Can Clock in Hz*/
 #define CONTROLLER_0_BDR_ID                      (0U)
 #define CONTROLLER0_ID                           (0U)
+#define CONTROLLER1_ID                           (1U)
 #define DEFAULT_BAUDRATE_CONFIGRATION_ID         (0U)
 
-/*Define HOH for Can module */
+/*Define HOH for Can module, one entry of HOHObj[] each */
 #define HTH0_0                                   (0U)
 #define HRH0_0                                   (1U)
-#define HTH0_1                                   (2U)
-#define HRH0_1                                   (3U)
+#define HTH1_0                                   (2U)
+#define HRH1_0                                   (3U)
+#define HTH0_1                                   (4U)
+#define HRH0_1                                   (5U)
 
 
 // ECUC_Can_00317
@@ -71,7 +84,9 @@
 
 #define CAN_HWOBJECT_COUNT 12
 
-#define CanBusoffProcessing POLLING
+/* Bus-off events: POLLING by Can_MainFunction_BusOff, or INTERRUPT notified from the
+ * status interrupt of the controller */
+#define CanBusoffProcessing INTERRUPT
 
 #define CanDevErrorDetect   STD_ON
 
@@ -79,7 +94,73 @@
 
 #define INTERRUPT_MODE 		(0x00)
 
-#define CanTriggerTransmitEnable    FALSE
+/* Enables the trigger transmit API (ECUC_Can_00486 CanTriggerTransmitEnable), Can_Write
+ * then accepts a NULL_PTR sdu and requests the data with CanIf_TriggerTransmit */
+#define CanTriggerTransmitEnable    TRUE
+
+/* Number of L-PDUs each HTH keeps in its software transmit queue while all of its
+ * hardware message objects are busy, the queue is ordered by CAN ID priority */
+#define CAN_TX_QUEUE_SIZE           (8U)
+
+/* Enables the cancellation of a pending lower priority L-PDU when all hardware
+ * message objects of an HTH are busy and a higher priority L-PDU is requested
+ * (ECUC_Can_00069 CanHardwareCancellation). Can_MainFunction_Write reports the
+ * cancellation, its period shall be longer than the longest frame (160 bits,
+ * 320 us at 500 kbit/s) so that a frame on the bus when cancelled has ended */
+#define CanHardwareCancellation     STD_ON
+
+/* Enables the deferred reception: Serve_Interrupts only copies the received frames into
+ * a ring buffer and Can_MainFunction_Read gives them to CanIf_RxIndication */
+#define CanRxDeferredProcessing     STD_ON
+
+/* Number of received frames the ring buffer holds, shall be a power of two up to 128 */
+#define CAN_RX_RING_SIZE            (16U)
+
+/* Enables the software acceptance filter (CanSwFilterRef) of the HRHs, the frames it
+ * rejects are dropped before any call to the upper layers */
+#define CanSwAcceptanceFilter       STD_ON
+
+/* Enables the receive buffer loans: the data of a received frame is read into a buffer of
+ * a static pool that is lent to CanIf_RxIndication, the upper layer keeps it until it
+ * calls Can_ReleaseRxBuffer */
+#define CanRxBufferLoan             STD_ON
+
+/* Number of buffers of the receive pool, up to 32 */
+#define CAN_RX_BUFFER_POOL_SIZE     (16U)
+
+/* Enables the time stamps: the reception and the transmit confirmation are time stamped
+ * with the core clock cycles of syst and given to CanIf_RxIndicationTimeStamp and
+ * CanIf_TxConfirmationTimeStamp instead of CanIf_RxIndication and CanIf_TxConfirmation */
+#define CanTimeStampEnable          STD_ON
+
+/* Enables the batched receive indication: the frames found in one read of a FIFO, or
+ * waiting in the ring buffer, are given together to CanIf_RxIndicationBatch instead of
+ * one call of CanIf_RxIndication each */
+#define CanRxIndicationBatch        STD_ON
+
+/* Maximum number of frames of one call of CanIf_RxIndicationBatch */
+#define CAN_RX_BATCH_SIZE           (8U)
+
+/* NVIC priority of the CAN interrupts, 1 (highest) to 7. The exclusive areas of the
+ * driver only mask the interrupts from this priority down */
+#define CAN_IRQ_PRIORITY            (1U)
+
+/* Enables the adaptive receive mode: a controller receiving more than
+ * CAN_RX_NAPI_THRESHOLD frames in CAN_RX_NAPI_WINDOW_US has its interrupts switched off
+ * and is served by the Timer0A tick every CAN_RX_NAPI_TICK_US, at most CAN_RX_NAPI_BUDGET
+ * frames per tick, until no event is pending anymore */
+#define CanRxAdaptivePolling        STD_ON
+#define CAN_RX_NAPI_THRESHOLD       (16U)
+#define CAN_RX_NAPI_WINDOW_US       (2000U)
+#define CAN_RX_NAPI_TICK_US         (500U)
+#define CAN_RX_NAPI_BUDGET          (32U)
+
+/* Enables the interrupt bottom half: CAN0_Handler and CAN1_Handler only acknowledge the
+ * events, latch the sent message objects and the bus-off and copy the received frames into
+ * the ring buffer of CanRxDeferredProcessing. The CanIf notifications and the refill of the
+ * transmit message objects from the queues are made by PendSV_Handler at the lowest
+ * priority, CAN_IRQ_PRIORITY shall then be below 7 */
+#define CanInterruptBottomHalf      STD_ON
 
 
 
@@ -9,7 +9,7 @@
 
 McuClockReferencePoint Clk = CLOCK;
 
-/*BaudRate Configuration For Controller 0*/
+/*BaudRate Configuration For Controller 0 and 1*/
 CanControllerBaudrateConfig CanControllerBaudrateConf[] =
 {
     {
@@ -23,7 +23,7 @@ CanControllerBaudrateConfig CanControllerBaudrateConf[] =
 
 };
 
-/*  Controller0 Configuration   */
+/*  Controller0 and Controller1 Configuration   */
 CanController CanControllerCfg[] =
 {
     {
@@ -61,19 +61,91 @@ CanHwFilter CanHwFilterHRH[] =
         3,                  /*  ID  */
         0x7FF               /*  Mask filter */
     }
+    ,
+    {
+        0,                  /*  ID  */
+        0x7F8               /*  Mask filter, IDs 0 to 7 and the 29-bit IDs starting with them */
+    }
+};
+
+/*Software acceptance filter of HRH1_0: 11-bit IDs accepted by the application among the
+  IDs 0 to 7 of its hardware filter, bit (ID & 31) of word (ID >> 5) */
+const uint32 CanSwFilterStdBitmapHRH1_0[2048 / 32] =
+{
+    [0x004 >> 5] = (1UL << (0x004 & 31)) | (1UL << (0x007 & 31))
 };
 
+/*Software acceptance filter of HRH1_0: 29-bit IDs accepted by the application among the
+  ones whose bits 28 to 18 pass its hardware filter, in ascending order */
+const uint32 CanSwFilterExtIdsHRH1_0[] =
+{
+    0x00012345,
+    0x001C0004
+};
+
+/*Software acceptance filter configuration for the HRHs*/
+const CanSwFilter CanSwFilterHRH[] =
+{
+    {
+        CanSwFilterStdBitmapHRH1_0,     /*  11-bit ID accept bitmap */
+        CanSwFilterExtIdsHRH1_0,        /*  Sorted accepted 29-bit IDs */
+        sizeof(CanSwFilterExtIdsHRH1_0) / sizeof(CanSwFilterExtIdsHRH1_0[0])    /*  Number of accepted 29-bit IDs */
+    }
+};
+
+#if (CanWriteBenchmarkConfig == STD_ON)
+/*Interrupt driven HTH of CAN0 with one message object, for the write benchmark*/
+#define BENCH_HTH(HohId)                                                                  \
+    {   FULL,                    /*  Can controller type for tm4c123gh6pm    */           \
+        1,                       /*  Number of message objects in the transmit pool */     \
+        STANDARD,                /*  Arbitration ID type */                                \
+        (HohId),                 /*  HOH ID  */                                            \
+        TRANSMIT,                /*  HOH Type    */                                        \
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */    \
+        &CanHwFilterHTH[0],      /*  Reference to the Filter configuartion   */            \
+        FALSE,                   /*  Enable or diasble using polling */                    \
+        NULL_PTR,                /*  Reference to the software acceptance filter */        \
+        8                        /*  Largest DLC received, not used as it's TRANSMIT HOH */ \
+    }
+
+/*Write benchmark configuration: the 31 HTHs 0 to 30 and the HRH 31 fill the 32 message
+  objects of CAN0, HTH 30 is the last one Can_Init resolves*/
+CanHardwareObject HOHObj[] =
+{
+    BENCH_HTH(0),  BENCH_HTH(1),  BENCH_HTH(2),  BENCH_HTH(3),  BENCH_HTH(4),
+    BENCH_HTH(5),  BENCH_HTH(6),  BENCH_HTH(7),  BENCH_HTH(8),  BENCH_HTH(9),
+    BENCH_HTH(10), BENCH_HTH(11), BENCH_HTH(12), BENCH_HTH(13), BENCH_HTH(14),
+    BENCH_HTH(15), BENCH_HTH(16), BENCH_HTH(17), BENCH_HTH(18), BENCH_HTH(19),
+    BENCH_HTH(20), BENCH_HTH(21), BENCH_HTH(22), BENCH_HTH(23), BENCH_HTH(24),
+    BENCH_HTH(25), BENCH_HTH(26), BENCH_HTH(27), BENCH_HTH(28), BENCH_HTH(29),
+    BENCH_HTH(30),
+    {
+         FULL,                    /*  Can controller type for tm4c123gh6pm    */
+         1,                       /*  Number of FIFO elements for this HOH    */
+         STANDARD,                /*  Arbitration ID type */
+         31,                      /*  HOH ID  */
+         RECEIVE,                 /*  HOH Type    */
+         &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+         &CanHwFilterHRH[0],      /*  Reference to the Filter configuartion   */
+         FALSE,                   /*  Enable or diasble using polling */
+         NULL_PTR,                /*  Reference to the software acceptance filter */
+         8                        /*  Largest DLC received */
+    }
+};
+#else
 /*Configuration FOR all used Hardware objects*/
 CanHardwareObject HOHObj[] =
 {
     {   FULL,                    /*  Can controller type for tm4c123gh6pm    */
-        1,                       /*  Number of FIFO elements for this HOH    */
+        2,                       /*  Number of message objects in the transmit pool of this HOH */
         STANDARD,                /*  Arbitration ID type */
         HTH0_0,                  /*  HOH ID  */
         TRANSMIT,                /*  HOH Type    */
         &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
         &CanHwFilterHTH[0],      /*  Reference to the Filter configuartion   */
-         FALSE                   /*  Enable or diasble using polling */
+         FALSE,                  /*  Enable or diasble using polling */
+         NULL_PTR,               /*  Reference to the software acceptance filter */
+         8                       /*  Largest DLC received, not used as it's TRANSMIT HOH */
     },
     {
          FULL,                    /*  Can controller type for tm4c123gh6pm    */
@@ -83,7 +155,33 @@ CanHardwareObject HOHObj[] =
          RECEIVE,                 /*  HOH Type    */
          &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
          &CanHwFilterHRH[0],      /*  Reference to the Filter configuartion   */
-         FALSE                    /*  Enable or diasble using polling */
+         FALSE,                   /*  Enable or diasble using polling */
+         NULL_PTR,                /*  Reference to the software acceptance filter */
+         8                        /*  Largest DLC received */
+    },
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        2,                       /*  Number of message objects in the transmit pool of this HOH */
+        STANDARD,                /*  Arbitration ID type */
+        HTH1_0,                  /*  HOH ID  */
+        TRANSMIT,                /*  HOH Type    */
+        &CanControllerCfg[1],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHTH[0],      /*  Reference to the Filter configuartion   */
+         FALSE,                  /*  Enable or diasble using polling */
+         NULL_PTR,               /*  Reference to the software acceptance filter */
+         8                       /*  Largest DLC received, not used as it's TRANSMIT HOH */
+    },
+    {
+         BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+         2,                       /*  Number of FIFO elements for this HOH    */
+         STANDARD,                /*  Arbitration ID type */
+         HRH1_0,                  /*  HOH ID  */
+         RECEIVE,                 /*  HOH Type    */
+         &CanControllerCfg[1],    /*  Reference to the controller this HOH belongs to */
+         &CanHwFilterHRH[2],      /*  Reference to the Filter configuartion   */
+         FALSE,                   /*  Enable or diasble using polling */
+         &CanSwFilterHRH[0],      /*  Reference to the software acceptance filter */
+         8                        /*  Largest DLC received */
     },
     {
          FULL,                    /*  Can controller type for tm4c123gh6pm    */
@@ -93,7 +191,9 @@ CanHardwareObject HOHObj[] =
          TRANSMIT,                /*  HOH Type    */
          &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
          &CanHwFilterHTH[0],      /*  Reference to the Filter configuartion   */
-         TRUE                    /*  Enable or diasble using polling */
+         TRUE,                   /*  Enable or diasble using polling */
+         NULL_PTR,               /*  Reference to the software acceptance filter */
+         8                       /*  Largest DLC received, not used as it's TRANSMIT HOH */
     },
     {
         FULL,                    /*  Can controller type for tm4c123gh6pm    */
@@ -103,9 +203,12 @@ CanHardwareObject HOHObj[] =
         RECEIVE,                 /*  HOH Type    */
         &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
         &CanHwFilterHRH[1],      /*  Reference to the Filter configuartion   */
-        TRUE                    /*  Enable or diasble using polling */
+        TRUE,                   /*  Enable or diasble using polling */
+        NULL_PTR,               /*  Reference to the software acceptance filter */
+        4                       /*  Largest DLC received */
     }
 };
+#endif
 
 
 /*This is the type of the external data structure containing the overall initialization 
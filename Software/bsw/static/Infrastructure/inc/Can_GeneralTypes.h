@@ -53,6 +53,8 @@
   #error "The AR version of Std_Types.h does not match the expected version"
 #endif
 
+#include "ComStack_Types.h"
+
 /* 
   [SWS_Can_91013]
   States that are used by the several ControllerMode functions.
@@ -112,6 +114,20 @@ typedef struct Can_Hw
   uint8 ControllerId ; // ControllerId provided by CanIf clearly identify the corresponding controller
 }Can_HwType;
 
+/*
+  Vendor specific
+  One received frame of a batch given to CanIf_RxIndicationBatch
+  1-Mailbox: CAN ID, HRH and controller of the frame, as given to CanIf_RxIndication
+  2-PduInfo: length and data of the frame, as given to CanIf_RxIndication
+  3-TimeStamp: core clock cycles when the frame was seen, 0 without time stamps
+*/
+typedef struct
+{
+  Can_HwType Mailbox ;
+  PduInfoType PduInfo ;
+  uint64 TimeStamp ;
+}Can_RxFrame;
+
 
 
 /* 
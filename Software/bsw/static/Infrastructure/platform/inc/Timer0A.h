@@ -25,6 +25,8 @@
 #ifndef __TIMER0AINTS_H__ // do not include more than once
 #define __TIMER0AINTS_H__
 
+#include <stdint.h>
+
 // ***************** Timer0A_Init ****************
 // Activate Timer0A interrupts to run user task periodically
 // Inputs:  task is a pointer to a user function
@@ -32,4 +34,16 @@
 // Outputs: none
 void Timer0A_Init(void);
 
+// ***************** Timer0A_InitTick ****************
+// Set up Timer0A as the receive polling tick of the CAN driver,
+// its interrupt stays disarmed until Timer0A_Arm
+// Inputs:  period in units (1/clockfreq), 32 bits
+//          priority of the interrupt, 0 to 7
+// Outputs: none
+void Timer0A_InitTick(uint32_t period, uint32_t priority);
+
+// Arm and disarm the Timer0A timeout interrupt
+void Timer0A_Arm(void);
+void Timer0A_Disarm(void);
+
 #endif // __TIMER0AINTS_H__
@@ -445,6 +445,133 @@ extern boolean CANRetryGet(uint32 ui32Base);
 extern void CANRetrySet(uint32 ui32Base, boolean bAutoRetry);
 extern uint32 CANStatusGet(uint32 ui32Base, tCANStsReg eStatusReg);
 
+//*****************************************************************************
+//
+//! \internal
+//! Builds the 16-bit value of one CAN data register from two bytes of a
+//! buffer, the first byte goes in the low byte of the register.
+//
+//*****************************************************************************
+#define CAN_DATA_PAIR(pui8Data, ui32Idx)                                     \
+        ((uint32)(pui8Data)[(ui32Idx)] |                                     \
+         ((uint32)(pui8Data)[(ui32Idx) + 1] << 8))
+
+//*****************************************************************************
+//
+//! Copies data from a buffer to the CAN Data registers.
+//!
+//! \param pui8Data is a pointer to the data to be written out to the CAN
+//! controller's data registers.
+//! \param pui32Register is an uint32 pointer to the first register of the
+//! CAN controller's data registers.  For example, in order to use the IF1
+//! register set on CAN controller 0, the value would be: \b CAN0_BASE \b +
+//! \b CAN_O_IF1DA1.
+//! \param ui32Size is the number of bytes to copy into the CAN controller.
+//! Values above 8 copy 8 bytes, as a CAN DLC above 8 does.
+//!
+//! This function takes the steps necessary to copy data from a contiguous
+//! buffer in memory into the non-contiguous data registers used by the CAN
+//! controller.  It is defined here so that it is inlined into the callers:
+//! an odd last byte is written alone, then the switch falls through one
+//! 16-bit register access per pair of bytes.
+//!
+//! \return None.
+//
+//*****************************************************************************
+static inline void
+CANDataRegSet(uint8 *pui8Data, uint32 *pui32Register, uint32 ui32Size)
+{
+    if(ui32Size > 8)
+    {
+        ui32Size = 8;
+    }
+
+    if(ui32Size & 1)
+    {
+        HWREG(pui32Register + (ui32Size >> 1)) = pui8Data[ui32Size - 1];
+    }
+
+    switch(ui32Size >> 1)
+    {
+        case 4:
+            HWREG(pui32Register + 3) = CAN_DATA_PAIR(pui8Data, 6);
+            // fall through
+        case 3:
+            HWREG(pui32Register + 2) = CAN_DATA_PAIR(pui8Data, 4);
+            // fall through
+        case 2:
+            HWREG(pui32Register + 1) = CAN_DATA_PAIR(pui8Data, 2);
+            // fall through
+        case 1:
+            HWREG(pui32Register) = CAN_DATA_PAIR(pui8Data, 0);
+            break;
+        default:
+            break;
+    }
+}
+
+//*****************************************************************************
+//
+//! Copies data from the CAN Data registers to a buffer.
+//!
+//! \param pui8Data is a pointer to the location to store the data read from
+//! the CAN controller's data registers.
+//! \param pui32Register is an uint32 pointer to the first register of the
+//! CAN controller's data registers.  For example, in order to use the IF1
+//! register set on CAN controller 1, the value would be: \b CAN0_BASE \b +
+//! \b CAN_O_IF1DA1.
+//! \param ui32Size is the number of bytes to copy from the CAN controller.
+//! Values above 8 copy 8 bytes, as a CAN DLC above 8 does.
+//!
+//! This function takes the steps necessary to copy data to a contiguous buffer
+//! in memory from the non-contiguous data registers used by the CAN
+//! controller.  It is inlined like CANDataRegSet().
+//!
+//! \return None.
+//
+//*****************************************************************************
+static inline void
+CANDataRegGet(uint8 *pui8Data, uint32 *pui32Register, uint32 ui32Size)
+{
+    uint32 ui32Value;
+
+    if(ui32Size > 8)
+    {
+        ui32Size = 8;
+    }
+
+    if(ui32Size & 1)
+    {
+        pui8Data[ui32Size - 1] = (uint8)HWREG(pui32Register + (ui32Size >> 1));
+    }
+
+    switch(ui32Size >> 1)
+    {
+        case 4:
+            ui32Value = HWREG(pui32Register + 3);
+            pui8Data[6] = (uint8)ui32Value;
+            pui8Data[7] = (uint8)(ui32Value >> 8);
+            // fall through
+        case 3:
+            ui32Value = HWREG(pui32Register + 2);
+            pui8Data[4] = (uint8)ui32Value;
+            pui8Data[5] = (uint8)(ui32Value >> 8);
+            // fall through
+        case 2:
+            ui32Value = HWREG(pui32Register + 1);
+            pui8Data[2] = (uint8)ui32Value;
+            pui8Data[3] = (uint8)(ui32Value >> 8);
+            // fall through
+        case 1:
+            ui32Value = HWREG(pui32Register);
+            pui8Data[0] = (uint8)ui32Value;
+            pui8Data[1] = (uint8)(ui32Value >> 8);
+            break;
+        default:
+            break;
+    }
+}
+
 //*****************************************************************************
 //
 // Mark the end of the C bindings section for C++ compilers.
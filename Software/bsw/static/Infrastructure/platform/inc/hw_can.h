@@ -369,7 +369,7 @@ typedef unsigned long long  uint64;
 #define CAN_IF2MSK2_MXTD        0x00008000  // Mask Extended Identifier
 #define CAN_IF2MSK2_MDIR        0x00004000  // Mask Message Direction
 #define CAN_IF2MSK2_IDMSK_M     0x00001FFF  // Identifier Mask
-#define CAN_IF2MSK2_IDMSK_STANDARD     0x1FF2
+#define CAN_IF2MSK2_IDMSK_STANDARD     0x1FFC
 
 //*****************************************************************************
 //
@@ -0,0 +1,57 @@
+/*******************************************************************************
+**                                                                            **
+**  Copyright (C) AUTOSarZs olc (2019)                                        **
+**                                                                            **
+**  All rights reserved.                                                      **
+**                                                                            **
+**  This document contains proprietary information belonging to AUTOSarZs     **
+**  olc . Passing on and copying of this document, and communication          **
+**  of its contents is not permitted without prior written authorization.     **
+**                                                                            **
+********************************************************************************
+**                                                                            **
+**  FILENAME     : syst.h                                                     **
+**                                                                            **
+**  VERSION      : 1.0.0                                                      **
+**                                                                            **
+**  DATE         : 2019-09-22                                                 **
+**                                                                            **
+**  VARIANT      : Variant PB                                                 **
+**                                                                            **
+**  PLATFORM     : TIVA C                                                     **
+**                                                                            **
+**  AUTHOR       : AUTOSarZs-DevTeam                                          **
+**                                                                            **
+**  VENDOR       : AUTOSarZs OLC                                              **
+**                                                                            **
+**                                                                            **
+**  DESCRIPTION  : system time base header file                               **
+**                                                                            **
+**  SPECIFICATION(S) : Specification of CAN Driver, AUTOSAR Release 4.3.1     **
+**                                                                            **
+**  MAY BE CHANGED BY USER : no                                               **
+**                                                                            **
+*******************************************************************************/
+
+
+#ifndef SYST_H_
+#define SYST_H_
+
+#include "Std_Types.h"
+#include "Can_Cfg.h"
+
+/* Core clock counted by the time base, in Hz, the CLOCK the CAN configuration runs at */
+#define SYST_CORE_CLOCK_HZ      ((uint32)CLOCK)
+
+/* Core clock cycles in one microsecond */
+#define SYST_CYCLES_PER_US      (SYST_CORE_CLOCK_HZ / 1000000UL)
+
+/*
+ * Free-running 64-bit time base counting the core clock cycles, built on the wide timer 0
+ * in its 64-bit mode. The timer is reserved for the time base.
+ */
+void syst_Init(void);
+void syst_GetTimeStampCycles(uint64 * timer);
+void syst_GetTimeStampus(uint64 * timer);
+
+#endif /* SYST_H_ */
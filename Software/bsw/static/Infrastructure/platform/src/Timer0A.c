@@ -28,6 +28,8 @@
 #include "Can_Cfg.h"
 #include <stdint.h>
 #include "../inc/tm4c123gh6pm.h"
+#include "Timer0A.h"
+#include "Can.h"
 
 
 //
@@ -70,7 +72,41 @@ void Timer0A_Init(void)
 
 }
 
+// ***************** Timer0A_InitTick ****************
+// Set up Timer0A as the receive polling tick of the CAN driver,
+// its interrupt stays disarmed until Timer0A_Arm
+// Inputs:  period in units (1/clockfreq), 32 bits
+//          priority of the interrupt, 0 to 7
+// Outputs: none
+void Timer0A_InitTick(uint32_t period, uint32_t priority){
+  SYSCTL_RCGCTIMER_R |= 0x01;   // 0) activate TIMER0
+  while((SYSCTL_PRTIMER_R & 0x01) == 0){};
+  TIMER0_CTL_R = 0x00000000;    // 1) disable TIMER0A during setup
+  TIMER0_CFG_R = 0x00000000;    // 2) configure for 32-bit mode
+  TIMER0_TAMR_R = 0x00000002;   // 3) configure for periodic mode, default down-count settings
+  TIMER0_TAILR_R = period - 1;  // 4) reload value
+  TIMER0_TAPR_R = 0;            // 5) bus clock resolution
+  TIMER0_ICR_R = 0x00000001;    // 6) clear TIMER0A timeout flag
+  TIMER0_IMR_R = 0x00000000;    // 7) timeout interrupt disarmed
+  NVIC_PRI4_R = (NVIC_PRI4_R&0x00FFFFFF)|(priority<<29); // 8) priority
+  NVIC_EN0_R = 1<<19;           // 9) enable IRQ 19 in NVIC
+  TIMER0_CTL_R = 0x00000001;    // 10) enable TIMER0A
+}
+
+void Timer0A_Arm(void){
+  TIMER0_ICR_R = 0x00000001;    // the tick starts a full period from now
+  TIMER0_TAV_R = TIMER0_TAILR_R;
+  TIMER0_IMR_R = 0x00000001;
+}
+
+void Timer0A_Disarm(void){
+  TIMER0_IMR_R = 0x00000000;
+  TIMER0_ICR_R = 0x00000001;
+}
+
 void Timer0A_Handler(void){
-//  TIMER0_ICR_R = TIMER_ICR_TATOCINT;// acknowledge timer0A timeout
-//  COM_Transmition();       // execute user task
+  TIMER0_ICR_R = 0x00000001;    // acknowledge timer0A timeout
+#if(CanRxAdaptivePolling == STD_ON)
+  Can_RxPollTick();             // budgeted polling of the CAN controllers
+#endif
 }
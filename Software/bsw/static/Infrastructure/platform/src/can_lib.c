@@ -198,107 +198,6 @@ _CANIntNumberGet(uint32 ui32Base)
     return(ui8Int);
 }
 */
-//*****************************************************************************
-//
-//! \internal
-//! Copies data from a buffer to the CAN Data registers.
-//!
-//! \param pui8Data is a pointer to the data to be written out to the CAN
-//! controller's data registers.
-//! \param pui32Register is an uint32 pointer to the first register of the
-//! CAN controller's data registers.  For example, in order to use the IF1
-//! register set on CAN controller 0, the value would be: \b CAN0_BASE \b +
-//! \b CAN_O_IF1DA1.
-//! \param iSize is the number of bytes to copy into the CAN controller.
-//!
-//! This function takes the steps necessary to copy data from a contiguous
-//! buffer in memory into the non-contiguous data registers used by the CAN
-//! controller.  This function is rarely used outside of the CANMessageSet()
-//! function.
-//!
-//! \return None.
-//
-//*****************************************************************************
-static void
-_CANDataRegWrite(uint8 *pui8Data, uint32 *pui32Register, uint32 ui32Size)
-{
-    uint32 ui32Idx, ui32Value;
-
-    //
-    // Loop always copies 1 or 2 bytes per iteration.
-    //
-    for(ui32Idx = 0; ui32Idx < ui32Size; )
-    {
-        //
-        // Write out the data 16 bits at a time since this is how the registers
-        // are aligned in memory.
-        //
-        ui32Value = pui8Data[ui32Idx++];
-
-        //
-        // Only write the second byte if needed otherwise the value is zero.
-        //
-        if(ui32Idx < ui32Size)
-        {
-            ui32Value |= (pui8Data[ui32Idx++] << 8);
-        }
-
-        HWREG(pui32Register++) = ui32Value;
-    }
-}
-
-//*****************************************************************************
-//
-//! \internal
-//! Copies data from a buffer to the CAN Data registers.
-//!
-//! \param pui8Data is a pointer to the location to store the data read from
-//! the CAN controller's data registers.
-//! \param pui32Register is an uint32 pointer to the first register of the
-//! CAN controller's data registers.  For example, in order to use the IF1
-//! register set on CAN controller 1, the value would be: \b CAN0_BASE \b +
-//! \b CAN_O_IF1DA1.
-//! \param iSize is the number of bytes to copy from the CAN controller.
-//!
-//! This function takes the steps necessary to copy data to a contiguous buffer
-//! in memory from the non-contiguous data registers used by the CAN
-//! controller.  This function is rarely used outside of the CANMessageGet()
-//! function.
-//!
-//! \return None.
-//
-//*****************************************************************************
-static void
-_CANDataRegRead( uint8 *pui8Data, uint32 *pui32Register, uint8 ui32Size)
-{
-    uint32 ui32Idx, ui32Value;
-
-    //
-    // Loop always copies 1 or 2 bytes per iteration.
-    //
-    for(ui32Idx = 0; ui32Idx < ui32Size; )
-    {
-        //
-        // Read out the data 16 bits at a time since this is how the registers
-        // are aligned in memory.
-        //
-        ui32Value = HWREG(pui32Register++);
-
-        //
-        // Store the first byte.
-        //
-        pui8Data[ui32Idx++] = (uint8)ui32Value;
-
-        //
-        // Only read the second byte if needed.
-        //
-        if(ui32Idx < ui32Size)
-        {
-            pui8Data[ui32Idx++] = (uint8)(ui32Value >> 8);
-        }
-    }
-}
-
 //*****************************************************************************
 //
 //! Initializes the CAN controller after reset.
@@ -1770,9 +1669,9 @@ CANMessageSet(uint32 ui32Base, uint32 ui32ObjID,
     //
     if(bTransferData)
     {
-        _CANDataRegWrite(psMsgObject->pui8MsgData,
-                         (uint32 *)(ui32Base + CAN_O_IF1DA1),
-                         psMsgObject->ui32MsgLen);
+        CANDataRegSet(psMsgObject->pui8MsgData,
+                      (uint32 *)(ui32Base + CAN_O_IF1DA1),
+                      psMsgObject->ui32MsgLen);
     }
 
     //
@@ -1862,29 +1761,29 @@ CANMessageGet(uint32 ui32Base, uint32 ui32ObjID,
     //
     // Set up the request for data from the message object.
     //
-    HWREG(ui32Base + CAN_O_IF2CMSK) = ui16CmdMaskReg;
+    HWREG(ui32Base + CAN_O_IF1CMSK) = ui16CmdMaskReg;
 
     //
     // Transfer the message object to the message object specified by
     // ui32ObjID.
     //
-    HWREG(ui32Base + CAN_O_IF2CRQ) = ui32ObjID & CAN_IF1CRQ_MNUM_M;
+    HWREG(ui32Base + CAN_O_IF1CRQ) = ui32ObjID & CAN_IF1CRQ_MNUM_M;
 
     //
     // Wait for busy bit to clear
     //
-    while(HWREG(ui32Base + CAN_O_IF2CRQ) & CAN_IF1CRQ_BUSY)
+    while(HWREG(ui32Base + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
     {
     }
 
     //
     // Read out the IF Registers.
     //
-    ui16MaskReg0 =HWREG(ui32Base + CAN_O_IF2MSK1);
-    ui16MaskReg1 =HWREG(ui32Base + CAN_O_IF2MSK2);
-    ui16ArbReg0 = HWREG(ui32Base + CAN_O_IF2ARB1);
-    ui16ArbReg1 = HWREG(ui32Base + CAN_O_IF2ARB2);
-    ui16MsgCtrl = HWREG(ui32Base + CAN_O_IF2MCTL);
+    ui16MaskReg0 =HWREG(ui32Base + CAN_O_IF1MSK1);
+    ui16MaskReg1 =HWREG(ui32Base + CAN_O_IF1MSK2);
+    ui16ArbReg0 = HWREG(ui32Base + CAN_O_IF1ARB1);
+    ui16ArbReg1 = HWREG(ui32Base + CAN_O_IF1ARB2);
+    ui16MsgCtrl = HWREG(ui32Base + CAN_O_IF1MCTL);
 
     psMsgObject->ui32Flags = MSG_OBJ_NO_FLAGS;
 
@@ -2020,26 +1919,26 @@ CANMessageGet(uint32 ui32Base, uint32 ui32ObjID,
             //
             // Read out the data from the CAN registers.
             //
-            _CANDataRegRead(psMsgObject->pui8MsgData,
-                            (uint32 *)(ui32Base + CAN_O_IF2DA1),
-                            psMsgObject->ui32MsgLen);
+            CANDataRegGet(psMsgObject->pui8MsgData,
+                          (uint32 *)(ui32Base + CAN_O_IF1DA1),
+                          psMsgObject->ui32MsgLen);
         }
 
         //
         // Now clear out the new data flag.
         //
-        HWREG(ui32Base + CAN_O_IF2CMSK) = CAN_IF1CMSK_NEWDAT;
+        HWREG(ui32Base + CAN_O_IF1CMSK) = CAN_IF1CMSK_NEWDAT;
 
         //
         // Transfer the message object to the message object specified by
         // ui32ObjID.
         //
-        HWREG(ui32Base + CAN_O_IF2CRQ) = ui32ObjID & CAN_IF1CRQ_MNUM_M;
+        HWREG(ui32Base + CAN_O_IF1CRQ) = ui32ObjID & CAN_IF1CRQ_MNUM_M;
 
         //
         // Wait for busy bit to clear
         //
-        while(HWREG(ui32Base + CAN_O_IF2CRQ) & CAN_IF1CRQ_BUSY)
+        while(HWREG(ui32Base + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
         {
         }
 
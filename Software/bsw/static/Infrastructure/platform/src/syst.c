@@ -0,0 +1,99 @@
+/*******************************************************************************
+**                                                                            **
+**  Copyright (C) AUTOSarZs olc (2019)		                                  **
+**                                                                            **
+**  All rights reserved.                                                      **
+**                                                                            **
+**  This document contains proprietary information belonging to AUTOSarZs     **
+**  olc . Passing on and copying of this document, and communication          **
+**  of its contents is not permitted without prior written authorization.     **
+**                                                                            **
+********************************************************************************
+**                                                                            **
+**  FILENAME     : syst.c                                                     **
+**                                                                            **
+**  VERSION      : 1.0.0                                                      **
+**                                                                            **
+**  DATE         : 2019-09-22                                                 **
+**                                                                            **
+**  VARIANT      : Variant PB                                                 **
+**                                                                            **
+**  PLATFORM     : TIVA C		                                              **
+**                                                                            **
+**  AUTHOR       : AUTOSarZs-DevTeam	                                      **
+**                                                                            **
+**  VENDOR       : AUTOSarZs OLC	                                          **
+**                                                                            **
+**                                                                            **
+**  DESCRIPTION  : system time base source file                               **
+**                                                                            **
+**  SPECIFICATION(S) : Specification of CAN Driver, AUTOSAR Release 4.3.1     **
+**                                                                            **
+**  MAY BE CHANGED BY USER : no                                               **
+**                                                                            **
+*******************************************************************************/
+
+#include "Std_Types.h"
+#include "tm4c123gh6pm.h"
+#include "syst.h"
+#include "Os.h"
+
+/* Wide timer 0 of the run mode clock gating and peripheral ready registers */
+#define SYST_WTIMER0            (0x01UL)
+
+/* GPTMCTL: TAEN, in the 64-bit mode it starts the concatenated timer */
+#define SYST_WTIMER_CTL_TAEN    (0x01UL)
+
+/* GPTMTAMR: periodic mode counting up */
+#define SYST_WTIMER_TAMR_UP     (0x12UL)
+
+/*
+ * Starts the wide timer 0 as a 64-bit periodic timer counting up at the system clock.
+ * It wraps after 2^64 cycles, the time base needs no interrupt and no periodic read.
+ * A timer already running is kept, so the time base never goes back.
+ */
+void syst_Init(void)
+{
+    SYSCTL_RCGCWTIMER_R |= SYST_WTIMER0 ;
+    while ((SYSCTL_PRWTIMER_R & SYST_WTIMER0) == 0)
+    {
+    }
+
+    if ((WTIMER0_CTL_R & SYST_WTIMER_CTL_TAEN) == 0)
+    {
+        WTIMER0_CFG_R   = 0x00000000 ;          /* 64-bit concatenated timer */
+        WTIMER0_TAMR_R  = SYST_WTIMER_TAMR_UP ;
+        WTIMER0_TAILR_R = 0xFFFFFFFFUL ;        /* low word of the 64-bit load value */
+        WTIMER0_TBILR_R = 0xFFFFFFFFUL ;        /* high word of the 64-bit load value */
+        WTIMER0_CTL_R   = SYST_WTIMER_CTL_TAEN ;
+    }
+}
+
+/*
+ * Core clock cycles since syst_Init, callable from the tasks and the interrupts.
+ * The low word is read between two reads of the high word, a carry in between
+ * gives two different high words and the read is repeated. No state is shared
+ * so nothing is locked.
+ */
+void syst_GetTimeStampCycles(uint64 * timer)
+{
+    uint32 High = 0 ;
+    uint32 Low = 0 ;
+
+    do
+    {
+        High = WTIMER0_TBV_R ;
+        Low  = WTIMER0_TAV_R ;
+    } while (High != WTIMER0_TBV_R) ;
+
+    *timer = ((uint64)High << 32) | Low ;
+}
+
+/* Microseconds since syst_Init */
+void syst_GetTimeStampus(uint64 * timer)
+{
+    uint64 Cycles = 0 ;
+
+    syst_GetTimeStampCycles(&Cycles) ;
+    *timer = Cycles / SYST_CYCLES_PER_US ;
+}
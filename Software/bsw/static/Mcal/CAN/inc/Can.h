@@ -102,6 +102,9 @@ typedef uint8 Can_ServiceId;
 #define  Can_GetControllerErrorState_Id       ((Can_ServiceId)0x11)
 #define  Can_GetControllerMode_Id             ((Can_ServiceId)0x12)
 #define  Can_Write_Id                         ((Can_ServiceId)0x06)
+#define  Can_WriteBatch_Id                    ((Can_ServiceId)0x40)      /* vendor specific */
+#define  Can_ReleaseRxBuffer_Id               ((Can_ServiceId)0x41)      /* vendor specific */
+#define  Can_GetRxModeCounters_Id             ((Can_ServiceId)0x42)      /* vendor specific */
 #define  Can_MainFunction_Write_ID            ((Can_ServiceId)0x01)
 #define  CAN_MAIN_FUNCTION_READ_ID            ((Can_ServiceId)0x08)
 #define  CAN_MAIN_FUNCTION_BUS_OFF_ID         ((Can_ServiceId)0x02)
@@ -235,6 +238,23 @@ typedef struct {
 	uint32 CanHwFilterMask;
 } CanHwFilter;
 
+//*****************************************************************************
+//  Software acceptance filter of an HRH, applied to the frames passing its
+//  hardware filter before CanIf_RxIndication is called. Vendor specific.
+//*****************************************************************************
+typedef struct {
+	/*2048 bit accept bitmap of the 11-bit identifiers, bit (Id & 31) of word
+	 (Id >> 5) set when Id is accepted. NULL_PTR accepts all of them*/
+	const uint32* CanSwFilterStdBitmap;
+
+	/*Accepted 29-bit identifiers sorted in ascending order. NULL_PTR accepts
+	 all of them*/
+	const uint32* CanSwFilterExtIds;
+
+	/*Number of identifiers in CanSwFilterExtIds*/
+	uint16 CanSwFilterExtIdCount;
+} CanSwFilter;
+
 //*****************************************************************************
 //  This container contains the configuration (parameters) of CAN Hardware
 //  Objects.
@@ -289,6 +309,19 @@ typedef struct
     *   Enables polling of this hardware object.
     */
     boolean    CanHardwareObjectUsesPolling;
+
+    /*
+    *   Software acceptance filter, only used by HRHs when CanSwAcceptanceFilter
+    *   is STD_ON. NULL_PTR accepts every frame passing the hardware filter.
+    */
+    const CanSwFilter*  CanSwFilterRef;
+
+    /*
+    *   Largest DLC of the frames received by this HRH, 1 to 8. The data bytes
+    *   above it are not read from the controller, a longer frame is dropped and
+    *   reported as CAN_E_DATALOST. Not used by the HTHs.
+    */
+    uint8   CanHwObjectMaxDlc;
 } CanHardwareObject;
 
 
@@ -330,6 +363,24 @@ typedef struct
     CanHardwareObject* CanHardwareObjectRef;
 
 } Can_ConfigType;
+
+//*****************************************************************************
+//  Counters of the adaptive receive mode of one controller. Vendor specific.
+//*****************************************************************************
+typedef struct
+{
+    /*Switches from the interrupts to the polling tick*/
+    uint32 ToPolling;
+
+    /*Switches back from the polling tick to the interrupts*/
+    uint32 ToInterrupt;
+
+    /*Frames read by the polling tick*/
+    uint32 PolledFrames;
+
+    /*TRUE while the controller is polled*/
+    boolean Polling;
+} Can_RxModeCountersType;
 /* -------------------------------------------------------------------------- */
 /*                             Functions Prototype                            */
 /* -------------------------------------------------------------------------- */
@@ -368,6 +419,57 @@ Std_ReturnType Can_SetBaudrate(uint8 Controller, uint16 BaudRateConfigID);
 
 void Can_DeInit(void);
 Std_ReturnType Can_write ( Can_HwHandleType Hth, const Can_PduType * PduInfo) ;
+
+/*****************************************************************************************/
+/*    Function Description    :Passes several L-PDUs for transmission under one interrupt*/
+/*                             lock, the result of each L-PDU is the one of Can_write    */
+/*    Parameter in            : const Can_HwHandleType Hth[], const Can_PduType PduInfo[]*/
+/*                              uint8 Count                                              */
+/*    Parameter inout         : none                                                     */
+/*    Parameter out           : Std_ReturnType Result[]                                  */
+/*    Return value            : Std_ReturnType                                           */
+/*    Requirment              : none (vendor specific)                                   */
+/*****************************************************************************************/
+Std_ReturnType Can_WriteBatch ( const Can_HwHandleType Hth[], const Can_PduType PduInfo[],
+                                uint8 Count, Std_ReturnType Result[]) ;
+
+#if(CanRxBufferLoan == STD_ON)
+/*****************************************************************************************/
+/*    Function Description    :Gives back a receive buffer lent by CanIf_RxIndication,   */
+/*                             the data of the frame shall not be used anymore           */
+/*    Parameter in            : const uint8 * SduDataPtr : SduDataPtr of the frame       */
+/*    Parameter inout         : none                                                     */
+/*    Parameter out           : none                                                     */
+/*    Return value            : none                                                     */
+/*    Requirment              : none (vendor specific)                                   */
+/*****************************************************************************************/
+void Can_ReleaseRxBuffer ( const uint8 * SduDataPtr ) ;
+#endif
+
+#if(CanRxAdaptivePolling == STD_ON)
+/*****************************************************************************************/
+/*    Function Description    :Polling tick of the controllers whose receive interrupts  */
+/*                             were switched off by a burst, called by Timer0A_Handler   */
+/*    Parameter in            : none                                                     */
+/*    Parameter inout         : none                                                     */
+/*    Parameter out           : none                                                     */
+/*    Return value            : none                                                     */
+/*    Requirment              : none (vendor specific)                                   */
+/*****************************************************************************************/
+void Can_RxPollTick ( void ) ;
+
+/*****************************************************************************************/
+/*    Function Description    :Gives the counters of the adaptive receive mode of a      */
+/*                             controller                                                */
+/*    Parameter in            : uint8 Controller                                         */
+/*    Parameter inout         : none                                                     */
+/*    Parameter out           : Can_RxModeCountersType * Counters                        */
+/*    Return value            : Std_ReturnType                                           */
+/*    Requirment              : none (vendor specific)                                   */
+/*****************************************************************************************/
+Std_ReturnType Can_GetRxModeCounters ( uint8 Controller, Can_RxModeCountersType * Counters ) ;
+#endif
+
 Std_ReturnType Can_SetControllerMode( uint8 Controller, Can_ControllerStateType Transition ) ;
 void Can_MainFunction_Read(void) ;
 void Can_DisableControllerInterrupts(uint8 Controller);
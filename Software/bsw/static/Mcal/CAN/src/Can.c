@@ -52,8 +52,9 @@
 #include "hw_can.h"
 #include "can_lib.h"
 #include "Can.h"
-#include "irq.h"
+#include "SchM_Can.h"
 #include "Timer0A.h"
+#include "syst.h"
 #include "Det.h"
 #include "CanIf_Cbk.h"
 /*****************************************************************************************/
@@ -65,6 +66,87 @@
 #define MAX_CONTROLLERS_NUMBER    (2U)                  /*Number of controllers in TivaC */
 #define CAN0_BASE_ADDRESS         (0x40040000U)
 #define CAN1_BASE_ADDRESS         (0x40041000U)
+#define CAN_OBJECT_UNUSED         (0xFFU)               /*Lookup table entry not mapped to any HOH */
+
+/*
+ * Notifications of the upper layer, the time stamp of the event is only passed on and
+ * taken when CanTimeStampEnable is on
+ */
+#if(CanTimeStampEnable == STD_ON)
+#define CAN_GET_TIMESTAMP(TimeStamp)                    syst_GetTimeStampCycles(&(TimeStamp))
+#define CAN_TX_CONFIRMATION(PduId, TimeStamp)           CanIf_TxConfirmationTimeStamp((PduId), (TimeStamp))
+#define CAN_RX_INDICATION(Mailbox, PduInfo, TimeStamp)  CanIf_RxIndicationTimeStamp((Mailbox), (PduInfo), (TimeStamp))
+#else
+#define CAN_GET_TIMESTAMP(TimeStamp)                    ((TimeStamp) = 0)
+#define CAN_TX_CONFIRMATION(PduId, TimeStamp)           CanIf_TxConfirmation(PduId)
+#define CAN_RX_INDICATION(Mailbox, PduInfo, TimeStamp)  CanIf_RxIndication((Mailbox), (PduInfo))
+#endif
+
+/*
+ * The CAN interrupts are used by the transmission, the reception or the bus-off events
+ */
+#if( CanTxProcessing == MIXED_PROCESSING || CanTxProcessing == INTERRUPT_PROCESSING ||\
+     CanRxProcessing == MIXED_PROCESSING || CanRxProcessing == INTERRUPT_PROCESSING ||\
+     CanBusoffProcessing == INTERRUPT )
+#define CAN_INTERRUPTS_USED       STD_ON
+#else
+#define CAN_INTERRUPTS_USED       STD_OFF
+#endif
+
+#if((CanRxAdaptivePolling == STD_ON) && (CAN_INTERRUPTS_USED == STD_OFF))
+  #error "CanRxAdaptivePolling switches between the CAN interrupts and polling, the interrupts shall be used"
+#endif
+
+#if(CanInterruptBottomHalf == STD_ON)
+/*
+ * PendSV runs the bottom half at the lowest of the 3 priority bits of the TM4C123, it is
+ * pended by the CAN interrupts once they latched an event for CanIf
+ */
+#define CAN_BOTTOM_HALF_PRIORITY  (7U)
+#define CAN_PEND_BOTTOM_HALF()    (SCB->ICSR = SCB_ICSR_PENDSVSET_Msk)
+
+#if(CAN_INTERRUPTS_USED == STD_OFF)
+  #error "CanInterruptBottomHalf splits the CAN interrupts, the interrupts shall be used"
+#endif
+#if(CanRxDeferredProcessing == STD_OFF)
+  #error "CanInterruptBottomHalf gives the received frames through the ring buffer of CanRxDeferredProcessing"
+#endif
+#if(CAN_IRQ_PRIORITY >= CAN_BOTTOM_HALF_PRIORITY)
+  #error "CAN_IRQ_PRIORITY shall be above the priority of the bottom half"
+#endif
+#endif
+
+#if((CanHardwareCancellation == STD_ON) && (CanTxProcessing == INTERRUPT_PROCESSING))
+  #error "CanHardwareCancellation reports the cancelled L-PDUs from Can_MainFunction_Write"
+#endif
+
+/*
+ * Budget of Serve_Interrupts serving all the pending events
+ */
+#define CAN_SERVE_ALL             (0xFFFFU)
+
+/*
+ * Window of the adaptive receive mode in core clock cycles
+ */
+#define CAN_RX_NAPI_WINDOW_CYCLES ((uint64)CAN_RX_NAPI_WINDOW_US * SYST_CYCLES_PER_US)
+
+/*
+ * Number of received frames given to the upper layer in one call
+ */
+#if(CanRxIndicationBatch == STD_ON)
+#define CAN_RX_INDICATION_FRAMES  CAN_RX_BATCH_SIZE
+#else
+#define CAN_RX_INDICATION_FRAMES  (1U)
+#endif
+
+/*
+ * Offsets added to the IF1 register offsets to select an interface register set.
+ * IF1 belongs to the task level (Can_write, Can_WriteBatch, Can_MainFunction_Write/Read),
+ * IF2 belongs to Serve_Interrupts, so neither waits on the BUSY bit of the other one.
+ * Can_Init uses both before the controller is started.
+ */
+#define CAN_IF_TASK               (0U)
+#define CAN_IF_ISR                (CAN_O_IF2CRQ - CAN_O_IF1CRQ)
 
 /*****************************************************************************************/
 /*                                   Local Definition                                    */
@@ -80,24 +162,145 @@
  its configured hardware message objects in the HW FIFO
  HRHIndex        : 	HRH index in the CanHardwareObject array
  StartMessageId  : 	ID of the first hardware message object in the HW FIFO
- StartMessageId  : 	ID of the last  hardware message object in the HW FIFO    */
+ StartMessageId  : 	ID of the last  hardware message object in the HW FIFO
+ PoolMask        : 	Bit n set when message object n+1 belongs to the HW FIFO
+ NextObject      : 	Index (message object number - 1) of the object expected to hold the
+                    oldest unread frame, the FIFO is read from it
+ ReadCmsk        : 	Command mask reading a frame of the HW FIFO, only with the data
+                    bytes up to MaxDlc and without ARB when the filter gives the ID
+ FixedCanId      : 	CAN ID of the frames when ARB is not read
+ MaxDlc          : 	Largest number of data bytes read from a frame, a frame with more
+                    data bytes is dropped                                             */
 typedef struct {
 	uint8 HRHIndex;
 	uint8 StartMessageId;
 	uint8 EndMessageId;
+	uint32 PoolMask;
+	uint8 NextObject;
+	uint32 ReadCmsk;
+	Can_IdType FixedCanId;
+	uint8 MaxDlc;
 } str_MessageObjAssignedToHRH;
 
 /*    Type Description      : 	Struct to map each transmit software meesage object with the number
-                                its configured hardware message objects in the HW FIFO 
+                                its configured hardware message objects in the HW transmit pool
             HTHIndex        :  HTH index in the CanHardwareObject array
-		    Tx_Request      :   Flag to indicate transmission request
-			StartMessageId  : 	ID of the  hardware meesage object in the HW    */
+		    Tx_Request      :   Bit n set when message object n+1 holds a transmission request
+		                        not yet confirmed to CanIf, updated with LDREX/STREX
+			StartMessageId  : 	ID of the first hardware message object in the HW pool
+			EndMessageId    : 	ID of the last  hardware message object in the HW pool
+			PoolMask        : 	Bit n set when message object n+1 belongs to the HW pool
+			Tx_Claimed      : 	Bit n set from the claim of message object n+1 until its
+			                    confirmation or cancellation, updated with LDREX/STREX
+			Tx_Done         : 	Bit n set when message object n+1 was sent and its confirmation
+			                    is left to the bottom half, the object stays claimed meanwhile
+			Tx_Sent         : 	Bit n set when the interrupt saw message object n+1 sent while it
+			                    was claimed but not yet in Tx_Request or Tx_Cancel, the task
+			                    setting its bit there confirms it, updated with LDREX/STREX
+			Tx_Cancel       : 	Bit n set while the request of message object n+1 is cancelled
+			                    and its L-PDU is neither confirmed nor reported cancelled yet,
+			                    updated with LDREX/STREX
+			Tx_CancelAged   : 	Bit n set when Can_MainFunction_Write found the cancellation of
+			                    message object n+1 open, only changed by the owner of the IF1
+			                    registers
+			BaseAddress     : 	Base address of the controller of the HTH
+			ControllerId    : 	ID of the controller of the HTH
+			Arb2Image       : 	Constant part of IF1ARB2 (DIR, MSGVAL, XTD), the ID is added
+			MsgCtrlImage    : 	Constant part of IF1MCTL (EOB, TXRQST, TXIE), the DLC is added */
 typedef struct
 {
 	uint8 HTHIndex;
-	uint8 Tx_Request;
-	uint8 MessageId;      
+	volatile uint32 Tx_Request;
+	uint8 StartMessageId;
+	uint8 EndMessageId;
+	uint32 PoolMask;
+	volatile uint32 Tx_Claimed;
+#if(CanInterruptBottomHalf == STD_ON)
+	volatile uint32 Tx_Done;
+#endif
+	volatile uint32 Tx_Sent;
+#if(CanHardwareCancellation == STD_ON)
+	volatile uint32 Tx_Cancel;
+	uint32 Tx_CancelAged;
+#endif
+	uint32 BaseAddress;
+	uint8 ControllerId;
+	uint16 Arb2Image;
+	uint16 MsgCtrlImage;
 }str_MessageObjAssignedToHTH;
+
+/*    Type Description      : 	L-PDU waiting in the software transmit queue of an HTH
+            swPduHandle     :   Handle given back in CanIf_TxConfirmation
+            id              :   CAN ID, the queue is sorted by it
+            length          :   Data length
+            TriggerTransmit :   TRUE when the data is requested with CanIf_TriggerTransmit
+                                once a message object is free, sdu is then not used
+            sdu             :   Copy of the data, the buffer of the caller is not kept   */
+typedef struct
+{
+	PduIdType swPduHandle;
+	Can_IdType id;
+	uint8 length;
+	boolean TriggerTransmit;
+	uint8 sdu[MAX_DATA_LENGTH];
+}str_TxQueueEntry;
+
+/*    Type Description      : 	Software transmit queue of an HTH
+            Count           :   Number of queued L-PDUs
+            Entry           :   Queued L-PDUs sorted by descending CAN ID, the last entry
+                                is the one with the highest priority                      */
+typedef struct
+{
+	uint8 Count;
+	str_TxQueueEntry Entry[CAN_TX_QUEUE_SIZE];
+}str_TxQueue;
+
+/*    Type Description      : 	Entry of the dense lookup tables built by Can_Init, used to
+                                resolve a handle or a hardware message object in constant time
+            ObjectType      :   TRANSMIT, RECEIVE or CAN_OBJECT_UNUSED
+            Index           :   Index in MessageObjAssignedToHTH[] or MessageObjAssignedToHRH[] */
+typedef struct
+{
+	uint8 ObjectType;
+	uint8 Index;
+}str_ObjectMap;
+
+/*    Type Description      : 	Frame read from a receive message object
+            CanId           :   CAN ID
+            Hoh             :   HRH that received the frame
+            ControllerId    :   Controller that received the frame
+            length          :   Data length
+            sdu             :   Data, in a buffer of RxBufferPool when it is lent to CanIf
+            TimeStamp       :   Core clock cycles of syst when the frame was seen          */
+typedef struct
+{
+	Can_IdType CanId;
+	Can_HwHandleType Hoh;
+	uint8 ControllerId;
+	uint8 length;
+#if(CanRxBufferLoan == STD_ON)
+	uint8 * sdu;
+#else
+	uint8 sdu[MAX_DATA_LENGTH];
+#endif
+	uint64 TimeStamp;
+}str_RxFrame;
+
+#if(CanRxDeferredProcessing == STD_ON)
+/*    Type Description      : 	Single producer (Serve_Interrupts) single consumer
+                                (Can_MainFunction_Read) ring buffer of received frames
+            Head            :   Free running count of the written frames, only changed by
+                                the producer
+            Tail            :   Free running count of the read frames, only changed by
+                                the consumer
+            Frame           :   Frames, indexed by the counts modulo CAN_RX_RING_SIZE       */
+typedef struct
+{
+	volatile uint8 Head;
+	volatile uint8 Tail;
+	str_RxFrame Frame[CAN_RX_RING_SIZE];
+}str_RxRing;
+#endif
 /*****************************************************************************************/
 /*                                Exported Variables Definition                          */
 /*****************************************************************************************/
@@ -141,23 +344,128 @@ static str_MessageObjAssignedToHRH MessageObjAssignedToHRH[CAN_HRH_NUMBER];
 /* assign each software HTH to a hardware message object                                  */
 static str_MessageObjAssignedToHTH MessageObjAssignedToHTH[CAN_HTH_NUMBER];
 
+/* Type Description  :    Struct                                                          */
+/* software transmit queue of each HTH, used when its hardware pool is busy               */
+static str_TxQueue TxQueue[CAN_HTH_NUMBER];
+
+/* Type Description  :    Lookup table indexed by the HOH handle (CanObjectId)            */
+/* gives the HOH type and its index in MessageObjAssignedToHTH/HRH                       */
+static str_ObjectMap HohHandleMap[CAN_HOH_NUMBER];
+
+/* Type Description  :    Lookup table indexed by controller and hardware message object */
+/* number - 1, gives the HOH type and its index in MessageObjAssignedToHTH/HRH           */
+static str_ObjectMap MessageObjMap[MAX_CONTROLLERS_NUMBER][CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS];
+
 /*
  * swPduHandle is a global variable updated in CAN_Write function from PduInfo pointer
- *  and saved to be passed to CanIf_TxConfirmation
+ *  and saved to be passed to CanIf_TxConfirmation, one entry per hardware message object
+ *  (message object number - 1) of each controller
+ */
+static PduIdType swPduHandle[MAX_CONTROLLERS_NUMBER][CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS];
+
+#if(CanHardwareCancellation == STD_ON)
+/*
+ * CAN ID of the L-PDU written in each hardware message object, used to find the
+ *  pending L-PDU with the lowest priority when a transmission has to be cancelled
  */
-static PduIdType swPduHandle[CAN_HTH_NUMBER];
+static Can_IdType TxPendingId[MAX_CONTROLLERS_NUMBER][CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS];
+#endif
 
 /*
- *  global variable used to protect the Hth in CAN_Write function
+ *  Bit n set while a task level function uses the IF1 registers of controller n, taken with
+ *  LDREX/STREX. A preempting task finding it set does not wait, it queues its L-PDU and
+ *  sets its bit in TaskIfMissed so that the owner drains the queues when it is done
  */
-static uint8 HTH_Semaphore[MAX_NO_OF_OBJECTS] = {0};
+static volatile uint32 TaskIfOwned = 0;
+static volatile uint32 TaskIfMissed = 0;
 
-/** ***************************************************************************************/
+#if(CanRxDeferredProcessing == STD_ON)
+/*
+ *  Received frames waiting for Can_MainFunction_Read. The interrupts of both controllers
+ *  have the same priority, so they never preempt each other and are a single producer
+ */
+static str_RxRing RxRing;
+
+/*
+ *  Number of frames dropped because the ring buffer was full, and the value of this count
+ *  when Can_MainFunction_Read last reported CAN_E_DATALOST
+ */
+static volatile uint32 RxRingLostCount = 0;
+static uint32 RxRingLostReported = 0;
+#endif
+
+#if(CanInterruptBottomHalf == STD_ON)
+/*
+ *  Bit n set when controller n went bus-off and CanIf_ControllerBusOff is left to the
+ *  bottom half, updated with LDREX/STREX
+ */
+static volatile uint32 BusOffPending = 0;
+
+#if(CanTimeStampEnable == STD_ON)
+/*
+ *  Time each message object of Tx_Done was seen sent by the interrupt
+ */
+static uint64 TxDoneTimeStamp[MAX_CONTROLLERS_NUMBER][CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS];
+#endif
+#endif
+
+/*
+ *  Number of frames each HRH lost because its hardware FIFO was full (MSGLST), and the
+ *  value of this count when Can_MainFunction_Read last reported CAN_E_DATALOST
+ */
+static volatile uint32 RxFifoLostCount[CAN_HRH_NUMBER];
+static uint32 RxFifoLostReported[CAN_HRH_NUMBER];
+
+/*
+ *  Number of frames each HRH dropped because their DLC was above its MaxDlc, and the
+ *  value of this count when Can_MainFunction_Read last reported CAN_E_DATALOST
+ */
+static volatile uint32 RxDlcLostCount[CAN_HRH_NUMBER];
+static uint32 RxDlcLostReported[CAN_HRH_NUMBER];
 
-static uint8 ClrPendingInt = 0;
+/*
+ *  Bit n set when message object n+1 of the controller belongs to a polled HRH, masks the
+ *  CANNWDA1/2 registers read by Can_MainFunction_Read
+ */
+static uint32 PolledRxMask[MAX_CONTROLLERS_NUMBER];
+
+#if(CanRxAdaptivePolling == STD_ON)
+/*    Type Description      : 	Adaptive receive mode of a controller
+            Polling         :   TRUE while the interrupts are off and the tick serves it
+            WindowStart     :   Core clock cycles at the start of the current window
+            WindowFrames    :   Frames received by the interrupt in the current window
+            Counters        :   Counters given by Can_GetRxModeCounters                    */
+typedef struct
+{
+	boolean Polling;
+	uint64 WindowStart;
+	uint16 WindowFrames;
+	Can_RxModeCountersType Counters;
+}str_RxNapi;
+
+/*
+ *  Only used by the CAN interrupts and the tick, which share the same priority
+ */
+static str_RxNapi RxNapi[MAX_CONTROLLERS_NUMBER];
+#endif
 
+#if(CanRxBufferLoan == STD_ON)
+/*
+ *  Data buffers lent to CanIf_RxIndication, bit n of RxBufferFree set while buffer n is
+ *  not lent, updated with LDREX/STREX as buffers are taken by the interrupt and the
+ *  tasks and given back from any context
+ */
+static uint8 RxBufferPool[CAN_RX_BUFFER_POOL_SIZE][MAX_DATA_LENGTH];
+static volatile uint32 RxBufferFree = 0;
+
+/*
+ *  Number of frames dropped because all buffers were lent
+ */
+static volatile uint32 RxBufferLostCount = 0;
+static uint32 RxBufferLostReported = 0;
+#endif
 
-static tCANMsgObject psMsgObject[CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS];
+/** ***************************************************************************************/
 
 
 /*****************************************************************************************/
@@ -167,60 +475,37 @@ static tCANMsgObject psMsgObject[CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS];
 /*****************************************************************************************/
 /*                                   Local Function Definition                           */
 /*****************************************************************************************/
-static void CANDataRegWrite ( uint8 * pui8Data, uint32 * pui32Register , uint8 ui8Size);
-
-
-//*****************************************************************************
-//
-//! \internal
-//! Copies data from a buffer to the CAN Data registers.
-//!
-//! \param pui8Data is a pointer to the location to store the data read from
-//! the CAN controller's data registers.
-//! \param pui32Register is an uint32 pointer to the first register of the
-//! CAN controller's data registers.  For example, in order to use the IF1
-//! register set on CAN controller 1, the value would be: \b CAN0_BASE \b +
-//! \b CAN_O_IF1DA1.
-//! \param iSize is the number of bytes to copy from the CAN controller.
-//!
-//! This function takes the steps necessary to copy data to a contiguous buffer
-//! in memory from the non-contiguous data registers used by the CAN
-//! controller.  This function is rarely used outside of the CANMessageGet()
-//! function.
-//!
-//! \return None.
-//
-//*****************************************************************************
-static void
-_CANDataRegRead( uint8 *pui8Data, uint32 *pui32Register, uint8 ui32Size)
-{
-    uint32_t ui32Idx, ui32Value;
-
-    //
-    // Loop always copies 1 or 2 bytes per iteration.
-    //
-    for(ui32Idx = 0; ui32Idx < ui32Size; )
-    {
-        //
-        // Read out the data 16 bits at a time since this is how the registers
-        // are aligned in memory.
-        //
-        ui32Value = HWREG(pui32Register++);
+static uint32 AtomicSetBits(volatile uint32 * Address, uint32 Bits);
+static uint32 AtomicClearBits(volatile uint32 * Address, uint32 Bits);
+static uint8 ClaimTxMessageObject(uint8 Hth_count);
+static void ReleaseTxMessageObject(uint8 Hth_count, uint8 HW_Obj_Index);
+static void ConfirmTxMessageObject(uint8 Hth_count, uint8 HW_Obj_Index);
+static void TakeSentTxMessageObject(uint8 Hth_count, uint8 HW_Obj_Index, volatile uint32 * Owner);
+static boolean AcquireTaskIf(uint8 ControllerId);
+static void ReleaseTaskIf(uint8 ControllerId);
+static void SetTxCommandRegisters(uint32 IfBase);
+static Std_ReturnType LoadTxMessageObject(uint8 Hth_count, uint32 IfOffset, uint8 real_hwObjectId, const Can_PduType * PduInfo);
+static Std_ReturnType WriteTxMessageObject(uint8 Hth_count, uint32 IfOffset, uint8 real_hwObjectId, const Can_PduType * PduInfo);
+static void TxQueueInsert(uint8 Hth_count, const Can_PduType * PduInfo);
+static void TxQueueDrain(uint8 Hth_count, uint32 IfOffset);
+static uint8 ReadRxFifo(uint8 Hrh_count, uint32 IfOffset, uint64 TimeStamp);
+static void IndicateRxFrames(const str_RxFrame Frame[], uint8 Count);
+#if(CanRxDeferredProcessing == STD_ON)
+static void RxRingDrain(void);
+#endif
+#if(CanRxBufferLoan == STD_ON)
+static uint8 * TakeRxBuffer(void);
+#endif
+#if(CanSwAcceptanceFilter == STD_ON)
+static boolean SwFilterAccept(const CanSwFilter * Filter, Can_IdType CanId, uint16 Extended);
+#endif
+#if(CanHardwareCancellation == STD_ON)
+static uint8 ClaimCancelTxMessageObject(uint8 Hth_count, Can_IdType id);
+static void CancelTxMessageObject(uint8 Hth_count, uint8 real_hwObjectId);
+static void ResolveTxCancellations(uint8 Hth_count);
+#endif
 
-        //
-        // Store the first byte.
-        //
-        pui8Data[ui32Idx++] = (uint8_t)ui32Value;
 
-        //
-        // Only read the second byte if needed.
-        //
-        if(ui32Idx < ui32Size)
-        {
-            pui8Data[ui32Idx++] = (uint8_t)(ui32Value >> 8);
-        }
-    }
-}
 /*****************************************************************************************/
 /*    Function Description    :  this function sets the baud rate                        */
 /*    Parameter in            :  BaseAddress : required controller base address 
@@ -406,11 +691,17 @@ void Can_Init( const Can_ConfigType* Config)
         /*[SRS_Can_01062] Each possible event of each CAN Controller shall be Pre-Compile-Time
          *  configurable to be in one of the following two modes Polling or Interrupt driven
          */
-#if( CanTxProcessing == MIXED_PROCESSING || CanTxProcessing == INTERRUPT_PROCESSING ||\
-     CanRxProcessing == MIXED_PROCESSING || CanRxProcessing == INTERRUPT_PROCESSING )
+#if(CAN_INTERRUPTS_USED == STD_ON)
         /*Enable interrupt for the controller*/
         HWREG(BaseAddress + CAN_O_CTL) |= CAN_CTL_IE ;
 #endif
+#if(CanBusoffProcessing == INTERRUPT)
+        /*
+         * The status interrupt is raised when BOFF or EWARN changes. SIE is not set, it would
+         * raise one more interrupt for every frame sent or received
+         */
+        HWREG(BaseAddress + CAN_O_CTL) |= CAN_CTL_EIE ;
+#endif
 
         /* Set Baud rate fo each controller */
         /* Save current baudrate Configurations */
@@ -422,6 +713,20 @@ void Can_Init( const Can_ConfigType* Config)
         ControllerState[controllerId] = CAN_CS_STOPPED ;
     }
 
+    /* Clear the lookup tables, entries not filled below stay unused */
+    for(HOHCount = 0; HOHCount < CAN_HOH_NUMBER; HOHCount++)
+    {
+        HohHandleMap[HOHCount].ObjectType = CAN_OBJECT_UNUSED;
+    }
+    for(controllerId = 0; controllerId < MAX_CONTROLLERS_NUMBER; controllerId++)
+    {
+        for(HwObjectCount = 0; HwObjectCount < CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS; HwObjectCount++)
+        {
+            MessageObjMap[controllerId][HwObjectCount].ObjectType = CAN_OBJECT_UNUSED;
+        }
+        PolledRxMask[controllerId] = 0;
+    }
+
     /* Loop to Configure Hardware message objects to be Transmit or receive */
     for(HOHCount = 0; HOHCount < CAN_HOH_NUMBER; HOHCount++)
     {
@@ -429,6 +734,16 @@ void Can_Init( const Can_ConfigType* Config)
         BaseAddress = Global_Config->CanHardwareObjectRef[HOHCount].CanControllerRef->CanControllerBaseAddress;
         /* Fetch the current HOH Controller ID */
         controllerId = Global_Config->CanHardwareObjectRef[HOHCount].CanControllerRef->CanControllerId;
+
+        /* HOH handles shall start with 0 and continue without any gaps (ECUC_Can_00326),
+         * a handle out of range is skipped as it would index HohHandleMap out of bounds */
+        if(Global_Config->CanHardwareObjectRef[HOHCount].CanObjectId >= CAN_HOH_NUMBER)
+        {
+        #if(CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_INIT_API_ID, CAN_E_INIT_FAILED);
+        #endif
+            continue;
+        }
         HWREG(BaseAddress + CAN_O_IF1CMSK) |= (CAN_IF1CMSK_WRNRD | CAN_IF1CMSK_ARB | CAN_IF1CMSK_CONTROL );
         
         /* Configuration for transmit message object type HTH */
@@ -457,23 +772,77 @@ void Can_Init( const Can_ConfigType* Config)
             }
             HWREG(BaseAddress + CAN_O_IF1ARB2) |= CAN_IF1ARB2_MSGVAL;           /* set as valid message object */
 
-            /* increament to save the number of occupied hardware objects */
-            UsedHWMessageObjt[controllerId]++;
+            MessageObjAssignedToHTH[HTHCount].HTHIndex = HOHCount;
+            MessageObjAssignedToHTH[HTHCount].Tx_Request = 0;
+            MessageObjAssignedToHTH[HTHCount].PoolMask = 0;
+            MessageObjAssignedToHTH[HTHCount].Tx_Claimed = 0;
+#if(CanInterruptBottomHalf == STD_ON)
+            MessageObjAssignedToHTH[HTHCount].Tx_Done = 0;
+#endif
+            MessageObjAssignedToHTH[HTHCount].Tx_Sent = 0;
+#if(CanHardwareCancellation == STD_ON)
+            MessageObjAssignedToHTH[HTHCount].Tx_Cancel = 0;
+            MessageObjAssignedToHTH[HTHCount].Tx_CancelAged = 0;
+#endif
+            TxQueue[HTHCount].Count = 0;
+
+            /* Precompute the register images used by the transmit path, which only adds
+             * the ID and the DLC to them */
+            MessageObjAssignedToHTH[HTHCount].BaseAddress = BaseAddress;
+            MessageObjAssignedToHTH[HTHCount].ControllerId = controllerId;
+            MessageObjAssignedToHTH[HTHCount].Arb2Image = CAN_IF1ARB2_DIR | CAN_IF1ARB2_MSGVAL;
+            if(Global_Config->CanHardwareObjectRef[HOHCount].CanIdType == EXTENDED)
+            {
+                MessageObjAssignedToHTH[HTHCount].Arb2Image |= CAN_IF1ARB2_XTD;
+            }
+            MessageObjAssignedToHTH[HTHCount].MsgCtrlImage = CAN_IF1MCTL_EOB | CAN_IF1MCTL_TXRQST;
+            if(Global_Config->CanHardwareObjectRef[HOHCount].CanHardwareObjectUsesPolling == FALSE)
+            {
+                MessageObjAssignedToHTH[HTHCount].MsgCtrlImage |= CAN_IF1MCTL_TXIE;
+            }
+            /*Save the ID of the first hardware message object used in the pool*/
+            MessageObjAssignedToHTH[HTHCount].StartMessageId = UsedHWMessageObjt[controllerId] + 1;
+
+            /* Each HTH owns a pool of "CanHwObjectCount" hardware message objects,
+             * Can_write uses any free one of them
+             */
+            HwObjectCount = Global_Config->CanHardwareObjectRef[HOHCount].CanHwObjectCount;
 
-            #if(CanDevErrorDetect == STD_ON)
-                if(UsedHWMessageObjt[controllerId] > CAN_HOH_NUMBER)
-                {
-                   /* Report error as the number of occupied hardware message objects exceeded limit 32 */
-                   Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_INIT_API_ID, CAN_E_INIT_FAILED);
-                }
-                else
+            /* Loop to configure all hardware objects in the pool of one HTH */
+            while(HwObjectCount--)
+            {
+                /* increament to save the number of occupied hardware objects */
+                UsedHWMessageObjt[controllerId]++;
+
+                #if(CanDevErrorDetect == STD_ON)
+                    if(UsedHWMessageObjt[controllerId] > CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS)
+                    {
+                       /* Report error as the number of occupied hardware message objects exceeded limit 32 */
+                       Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_INIT_API_ID, CAN_E_INIT_FAILED);
+                    }
+                    else
+                    {
+                       /* Do Nothing */
+                    }
+                #endif
+                /* Every hardware message object of the pool points to the same HTH */
+                MessageObjMap[controllerId][UsedHWMessageObjt[controllerId] - 1].ObjectType = TRANSMIT;
+                MessageObjMap[controllerId][UsedHWMessageObjt[controllerId] - 1].Index = HTHCount;
+                MessageObjAssignedToHTH[HTHCount].PoolMask |= ((uint32)1 << (UsedHWMessageObjt[controllerId] - 1));
+
+                /* Wait for the previous transfer of the IF1 registers to finish */
+                while(HWREG(BaseAddress + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
                 {
-                   /* Do Nothing */
                 }
-            #endif
-            MessageObjAssignedToHTH[HTHCount].HTHIndex = HOHCount;
-            MessageObjAssignedToHTH[HTHCount++].MessageId = UsedHWMessageObjt[controllerId];
-            HWREG(BaseAddress + CAN_O_IF1CRQ)   = UsedHWMessageObjt[controllerId];
+                HWREG(BaseAddress + CAN_O_IF1CRQ)   = UsedHWMessageObjt[controllerId];
+            }
+
+            /* Fill the lookup table for the handle */
+            HohHandleMap[Global_Config->CanHardwareObjectRef[HOHCount].CanObjectId].ObjectType = TRANSMIT;
+            HohHandleMap[Global_Config->CanHardwareObjectRef[HOHCount].CanObjectId].Index = HTHCount;
+
+            /* Save the ID of the last hardware message object used in the pool */
+            MessageObjAssignedToHTH[HTHCount++].EndMessageId = UsedHWMessageObjt[controllerId];
         }
         /* Configuration for receive message object type HRH */
         else if(Global_Config->CanHardwareObjectRef[HOHCount].CanObjectType == RECEIVE)
@@ -482,12 +851,41 @@ void Can_Init( const Can_ConfigType* Config)
             * a hardware FIFO. The size of the FIFO is configured via "CanHwObjectCount".
             */
             HwObjectCount = Global_Config->CanHardwareObjectRef[HOHCount].CanHwObjectCount;
+            MessageObjAssignedToHRH[HRHCount].PoolMask = 0;
+
+            /*
+             * The frames are read with the control bits, the data bytes up to the largest
+             * DLC of the HRH and the arbitration bits. An 11-bit filter comparing all the ID
+             * bits only receives its code, the ID is then taken from the configuration
+             */
+            MessageObjAssignedToHRH[HRHCount].MaxDlc = Global_Config->CanHardwareObjectRef[HOHCount].CanHwObjectMaxDlc;
+            if((MessageObjAssignedToHRH[HRHCount].MaxDlc == 0) || (MessageObjAssignedToHRH[HRHCount].MaxDlc > MAX_DATA_LENGTH))
+            {
+                MessageObjAssignedToHRH[HRHCount].MaxDlc = MAX_DATA_LENGTH;
+            }
+            MessageObjAssignedToHRH[HRHCount].ReadCmsk = CAN_IF1CMSK_CONTROL | CAN_IF1CMSK_DATAA | CAN_IF1CMSK_CLRINTPND;
+            if(MessageObjAssignedToHRH[HRHCount].MaxDlc > 4)
+            {
+                MessageObjAssignedToHRH[HRHCount].ReadCmsk |= CAN_IF1CMSK_DATAB;
+            }
+            MessageObjAssignedToHRH[HRHCount].FixedCanId = Global_Config->CanHardwareObjectRef[HOHCount].CanHwFilterRef->CanHwFilterCode & 0x7FF;
+            if((Global_Config->CanHardwareObjectRef[HOHCount].CanIdType != STANDARD) ||
+               ((Global_Config->CanHardwareObjectRef[HOHCount].CanHwFilterRef->CanHwFilterMask & 0x7FF) != 0x7FF))
+            {
+                MessageObjAssignedToHRH[HRHCount].ReadCmsk |= CAN_IF1CMSK_ARB;
+            }
+            RxFifoLostCount[HRHCount] = 0;
+            RxFifoLostReported[HRHCount] = 0;
+            RxDlcLostCount[HRHCount] = 0;
+            RxDlcLostReported[HRHCount] = 0;
 
             /* Loop to configure all hardware objects in the FIFO to Configure one HRH */
             while(HwObjectCount--)
             {
                 HWREG(BaseAddress + CAN_O_IF2CMSK) |= (CAN_IF2CMSK_WRNRD | CAN_IF2CMSK_ARB | CAN_IF2CMSK_CONTROL | CAN_IF2CMSK_MASK);
-                HWREG(BaseAddress + CAN_O_IF2MCTL) |= (CAN_IF2MCTL_UMASK |CAN_IF2MCTL_DLC_M);
+                /* Only the last object of the FIFO gets EOB, so the control bits are not
+                 * kept from the previous object */
+                HWREG(BaseAddress + CAN_O_IF2MCTL) = (CAN_IF2MCTL_UMASK |CAN_IF2MCTL_DLC_M);
                 if(Global_Config->CanHardwareObjectRef[HOHCount].CanHardwareObjectUsesPolling == FALSE)
                 {
                     HWREG(BaseAddress + CAN_O_IF2MCTL) |= (CAN_IF2MCTL_RXIE );          /*Enable transmission interrupt for this HRH*/
@@ -500,11 +898,18 @@ void Can_Init( const Can_ConfigType* Config)
                 if(Global_Config->CanHardwareObjectRef[HOHCount].CanIdType == STANDARD)
                 {
                     /* When using an 11-bit identifier, [12:2]bits are used for bits [10:0] of the ID. */
-                    HWREG(BaseAddress + CAN_O_IF2ARB2) &= ~CAN_IF2ARB2_XTD;
+                    /* The ID of the previous object is cleared, it is not ORed with this one */
+                    HWREG(BaseAddress + CAN_O_IF2ARB2) &= ~(CAN_IF2ARB2_XTD | CAN_IF2ARB2_ID_M);
                     HWREG(BaseAddress + CAN_O_IF2ARB2) |= (CAN_IF2ARB2_ID_STANDARD) & ((Global_Config-> \
                             CanHardwareObjectRef[HOHCount].CanHwFilterRef->CanHwFilterCode) << 2);
                     HWREG(BaseAddress + CAN_O_IF2MSK2) = (CAN_IF2MSK2_IDMSK_STANDARD) & ((Global_Config-> \
                             CanHardwareObjectRef[HOHCount].CanHwFilterRef->CanHwFilterMask) << 2);
+                    if(0 == (MessageObjAssignedToHRH[HRHCount].ReadCmsk & CAN_IF1CMSK_ARB))
+                    {
+                        /* The 29-bit frames whose first bits match the code are not received,
+                         * the ID read is the code */
+                        HWREG(BaseAddress + CAN_O_IF2MSK2) |= CAN_IF2MSK2_MXTD;
+                    }
                 }
                 else if(Global_Config->CanHardwareObjectRef[HOHCount].CanIdType == EXTENDED)
                 {
@@ -532,7 +937,7 @@ void Can_Init( const Can_ConfigType* Config)
                 UsedHWMessageObjt[controllerId]++;
 
                 #if(CanDevErrorDetect == STD_ON)
-                    if(UsedHWMessageObjt[controllerId] > CAN_HOH_NUMBER)
+                    if(UsedHWMessageObjt[controllerId] > CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS)
                     {
                        /* Report error as the number of occupied hardware message objects exceeded limit 32 */
                        Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_INIT_API_ID, CAN_E_INIT_FAILED);
@@ -542,8 +947,20 @@ void Can_Init( const Can_ConfigType* Config)
                        /* Do Nothing */
                     }
                 #endif
+                /* Every hardware message object of the FIFO points to the same HRH */
+                MessageObjMap[controllerId][UsedHWMessageObjt[controllerId] - 1].ObjectType = RECEIVE;
+                MessageObjMap[controllerId][UsedHWMessageObjt[controllerId] - 1].Index = HRHCount;
+                MessageObjAssignedToHRH[HRHCount].PoolMask |= ((uint32)1 << (UsedHWMessageObjt[controllerId] - 1));
+                if(Global_Config->CanHardwareObjectRef[HOHCount].CanHardwareObjectUsesPolling == TRUE)
+                {
+                    PolledRxMask[controllerId] |= ((uint32)1 << (UsedHWMessageObjt[controllerId] - 1));
+                }
+
                 if(HwObjectCount == 0)  /* End of FIFO Reached */
                 {
+                    HohHandleMap[Global_Config->CanHardwareObjectRef[HOHCount].CanObjectId].ObjectType = RECEIVE;
+                    HohHandleMap[Global_Config->CanHardwareObjectRef[HOHCount].CanObjectId].Index = HRHCount;
+
                     /* Set cuurent hardware message as the last one in FIFO */
                     HWREG(BaseAddress + CAN_O_IF2MCTL) |= CAN_IF2MCTL_EOB ;
                     /* Map the Current Software HRH with its hardware messages used in the buffer */
@@ -551,6 +968,8 @@ void Can_Init( const Can_ConfigType* Config)
                     /*Save the ID of the first hardware message object used in the FIFO*/
                     MessageObjAssignedToHRH[HRHCount].StartMessageId = UsedHWMessageObjt[controllerId] - \
                             Global_Config->CanHardwareObjectRef[HOHCount].CanHwObjectCount + 1;
+                    /* The first frame is stored in the first object of the FIFO */
+                    MessageObjAssignedToHRH[HRHCount].NextObject = MessageObjAssignedToHRH[HRHCount].StartMessageId - 1;
                     /* Save the ID of the last hardware message object used in the FIFO */
                     MessageObjAssignedToHRH[HRHCount++].EndMessageId = UsedHWMessageObjt[controllerId];
                 }
@@ -561,6 +980,39 @@ void Can_Init( const Can_ConfigType* Config)
         }
     }
 
+#if(CanRxDeferredProcessing == STD_ON)
+    /* The received frames of a previous initialization are dropped */
+    RxRing.Head = 0;
+    RxRing.Tail = 0;
+#endif
+#if(CanInterruptBottomHalf == STD_ON)
+    /* The bottom half is preempted by any interrupt, the CAN ones included */
+    BusOffPending = 0;
+    SCB->SHP[10] = (uint8)(CAN_BOTTOM_HALF_PRIORITY << 5);
+#endif
+#if(CanRxBufferLoan == STD_ON)
+    /* All receive buffers are free */
+    RxBufferFree = (uint32)(((uint64)1 << CAN_RX_BUFFER_POOL_SIZE) - 1);
+#endif
+#if((CanTimeStampEnable == STD_ON) || (CanRxAdaptivePolling == STD_ON))
+    /* Start of the time base of the time stamps and of the receive windows */
+    syst_Init();
+#endif
+#if(CanRxAdaptivePolling == STD_ON)
+    /* All the controllers start interrupt driven, the tick is armed by a burst */
+    for(controllerId = 0; controllerId < MAX_CONTROLLERS_NUMBER; controllerId++)
+    {
+        RxNapi[controllerId].Polling = FALSE;
+        RxNapi[controllerId].WindowStart = 0;
+        RxNapi[controllerId].WindowFrames = 0;
+        RxNapi[controllerId].Counters.ToPolling = 0;
+        RxNapi[controllerId].Counters.ToInterrupt = 0;
+        RxNapi[controllerId].Counters.PolledFrames = 0;
+        RxNapi[controllerId].Counters.Polling = FALSE;
+    }
+    Timer0A_InitTick(CAN_RX_NAPI_TICK_US * (CLOCK / 1000000), CAN_IRQ_PRIORITY);
+#endif
+
     /* [SWS_Can_00246]  ? The function Can_Init shall change the module state to CAN_READY,
     * after initializing all controllers inside  the HWUnit. (SRS_SPAL_12057, SRS_Can_01041) 
     */
@@ -736,7 +1188,7 @@ Std_ReturnType Can_SetBaudrate(uint8 Controller, uint16 BaudRateConfigID) {
 /*****************************************************************************************/
 void Can_EnableControllerInterrupts(uint8 Controller) {
 	/* Critical Section to protect shared resources in a reentrant Function */
-	irq_Disable();
+	SchM_Enter_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
 #if(CanDevErrorDetect == STD_ON)
 	
 	/*  [SWS_Can_00209] The function Can_EnableControllerInterrupts shall raise the error CAN_E_UNINIT if
@@ -775,15 +1227,21 @@ void Can_EnableControllerInterrupts(uint8 Controller) {
         /* [SWS_Can_00050] The function Can_EnableControllerInterrupts shall enable all
          * interrupts that must be enabled according the current software status
          */
+#if(CanRxAdaptivePolling == STD_ON)
+		/*  A controller in a receive burst gets its interrupts back from the polling tick */
+		if (FALSE == RxNapi[Controller].Polling)
+#endif
+		{
 		/*  Enable the specified CAN Controller Interrupts */
-		CANIntEnable(Global_Config->CanHardwareObjectRef[Controller].CanControllerRef->CanControllerBaseAddress,
+		CANIntEnable(Global_Config->CanControllerCfgRef[Controller].CanControllerBaseAddress,
 				 CAN_CTL_IE);
+		}
     }
 	else
 	{
 	}
     /* End of Critical Section */
-	irq_Enable();
+	SchM_Exit_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
 }
 
 /*****************************************************************************************/
@@ -798,7 +1256,7 @@ void Can_EnableControllerInterrupts(uint8 Controller) {
 /*****************************************************************************************/
 void Can_DisableControllerInterrupts(uint8 Controller) {
 	/* Critical Section to protect shared resources in a reentrant Function */
-	irq_Disable();
+	SchM_Enter_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
 #if(CanDevErrorDetect == STD_ON)
 
     /*  [SWS_Can_00205] The function Can_DisableControllerInterrupts shall raise the error CAN_E_UNINIT if
@@ -829,13 +1287,13 @@ void Can_DisableControllerInterrupts(uint8 Controller) {
          *  interrupts for that CAN Controller are enabled
          */
         /*  Disable the specified CAN Controller Interrupts */
-		CANIntDisable(Global_Config->CanHardwareObjectRef[Controller].CanControllerRef->CanControllerBaseAddress,
+		CANIntDisable(Global_Config->CanControllerCfgRef[Controller].CanControllerBaseAddress,
 				 CAN_CTL_IE);
     }
     DisableCnt[Controller]++;
 
     /* End of Critical Section */
-	irq_Enable();
+	SchM_Exit_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
 }
 
 /*****************************************************************************************/
@@ -885,9 +1343,13 @@ void Can_DeInit(void)
 	for(ControllerIndex = 0; ControllerIndex < USED_CONTROLLERS_NUMBER; ControllerIndex++)
 	{
 		/*	Disable the first four bits in CAN Control Register in both controllers */
-		CLR_BITS( HWREG(Global_Config->CanHardwareObjectRef[ControllerIndex].CanControllerRef->CanControllerBaseAddress + CAN_O_CTL),0
+		CLR_BITS( HWREG(Global_Config->CanControllerCfgRef[ControllerIndex].CanControllerBaseAddress + CAN_O_CTL),0
 				 , CAN_CTL_INIT | CAN_CTL_IE | CAN_CTL_SIE | CAN_CTL_EIE );   // DeInit CAN controller of ControllerIndex
 	}
+#if(CanRxAdaptivePolling == STD_ON)
+	/* No controller is polled anymore */
+	Timer0A_Disarm();
+#endif
 }
 
 /****************************************************************************************/
@@ -905,53 +1367,105 @@ void Can_DeInit(void)
 void Can_MainFunction_Read(void) 
 {
 
-/*variable to get HRH index in the HWObject array */
- uint8 index = 0 ;
-/*array to save received data*/
- uint8 data[MAX_DATA_LENGTH] ;
+/*variable to get HRH index in MessageObjAssignedToHRH[] */
+ uint8 obj_index = 0 ;
+ uint8 controllerId = 0 ;
+ uint8 HW_Obj_Index = 0 ;
+ uint32 BaseAddress = 0 ;
+/*polled message objects of a controller holding a frame not read yet*/
+ uint32 NewData = 0 ;
+/*time the polled frames were seen*/
+ uint64 TimeStamp = 0 ;
+
+#if(CanRxDeferredProcessing == STD_ON)
+#if(CanInterruptBottomHalf == STD_OFF)
+    /*
+     * Give the frames queued by Serve_Interrupts to CanIf, PendSV_Handler does it when the
+     * interrupts have a bottom half
+     */
+    RxRingDrain();
+#endif
+
+    if(RxRingLostCount != RxRingLostReported)
+    {
+        RxRingLostReported = RxRingLostCount;
+        /*
+         * [SWS_Can_00395] frames received while the ring buffer was full are lost
+         */
+        #if(CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_MAIN_FUNCTION_READ_ID, CAN_E_DATALOST);
+        #endif
+    }
+#endif
 
     /*
      * loop for all the hardware object to get the only new avialables data in this object
      */
 
-    for(uint8 obj_index = 0; obj_index < CAN_HRH_NUMBER; obj_index++)
+    for(controllerId = 0; controllerId < USED_CONTROLLERS_NUMBER; controllerId++)
     {
-        index = MessageObjAssignedToHRH[obj_index].HRHIndex ;
-       if(TRUE == Global_Config->CanHardwareObjectRef[index].CanHardwareObjectUsesPolling)
-       {
-            for(uint8 HW_Obj_Index = MessageObjAssignedToHRH[obj_index].StartMessageId;
-                HW_Obj_Index <= MessageObjAssignedToHRH[obj_index].EndMessageId ; HW_Obj_Index++)
-            {
-                /*Initialize data pointer */
-                 psMsgObject[HW_Obj_Index].pui8MsgData = data;
+        /*
+         * One read of the new data registers gives the polled message objects holding a
+         * frame, the other ones are not accessed. The message objects are read through the
+         * IF1 registers, when a preempted task uses them the new data stays in the message
+         * objects until the next call
+         */
+        BaseAddress = Global_Config->CanControllerCfgRef[controllerId].CanControllerBaseAddress ;
+        NewData = (HWREG(BaseAddress + CAN_O_NWDA1) | (HWREG(BaseAddress + CAN_O_NWDA2) << 16)) &
+                  PolledRxMask[controllerId] ;
 
-                /*
-                 * Reads a CAN message from one of the message object buffers.
-                 */
-                    CANMessageGet(Global_Config->CanHardwareObjectRef[obj_index].CanControllerRef->CanControllerBaseAddress,
-                                  HW_Obj_Index, &psMsgObject[HW_Obj_Index], ClrPendingInt);
-                // check if this object have new data available
-                if(( psMsgObject[HW_Obj_Index].ui32Flags & MSG_OBJ_NEW_DATA) == MSG_OBJ_NEW_DATA)
-                {
-                    // mailbox for Callback function RxIndication
-                    Can_HwType Mailbox;
-                    PduInfoType PduInfo;
-                    //message ID
-                    Mailbox.CanId = psMsgObject[HW_Obj_Index].ui32MsgID;
-                    //hardware object that has new data
-                    Mailbox.Hoh = obj_index;
-                    // controller ID
-                    Mailbox.ControllerId = Global_Config->CanHardwareObjectRef[index].CanControllerRef->CanControllerId;
-                    //Save data length
-                    PduInfo.SduLength = psMsgObject[HW_Obj_Index].ui32MsgLen;
-                    //Save data
-                    PduInfo.SduDataPtr = psMsgObject[HW_Obj_Index].pui8MsgData;
-                    // 2. inform CanIf using API below.
-                    CanIf_RxIndication(&Mailbox, &PduInfo);
-                }
+        if((0 != NewData) && (TRUE == AcquireTaskIf(controllerId)))
+        {
+            CAN_GET_TIMESTAMP(TimeStamp) ;
+            while(0 != NewData)
+            {
+                HW_Obj_Index = (uint8)__CLZ(__RBIT(NewData)) ;
+                obj_index = MessageObjMap[controllerId][HW_Obj_Index].Index ;
 
+                /* The whole FIFO of the HRH is read */
+                (void)ReadRxFifo(obj_index, CAN_IF_TASK, TimeStamp) ;
+                NewData &= ~MessageObjAssignedToHRH[obj_index].PoolMask ;
             }
-       }
+            ReleaseTaskIf(controllerId) ;
+        }
+    }
+
+#if(CanRxBufferLoan == STD_ON)
+    if(RxBufferLostCount != RxBufferLostReported)
+    {
+        RxBufferLostReported = RxBufferLostCount;
+        /*
+         * [SWS_Can_00395] frames received while all the receive buffers were lent are lost
+         */
+        #if(CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_MAIN_FUNCTION_READ_ID, CAN_E_DATALOST);
+        #endif
+    }
+#endif
+
+    for(obj_index = 0; obj_index < CAN_HRH_NUMBER; obj_index++)
+    {
+        if(RxFifoLostCount[obj_index] != RxFifoLostReported[obj_index])
+        {
+            RxFifoLostReported[obj_index] = RxFifoLostCount[obj_index];
+            /*
+             * [SWS_Can_00395] frames were overwritten in the hardware FIFO of this HRH
+             */
+            #if(CanDevErrorDetect == STD_ON)
+                Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_MAIN_FUNCTION_READ_ID, CAN_E_DATALOST);
+            #endif
+        }
+
+        if(RxDlcLostCount[obj_index] != RxDlcLostReported[obj_index])
+        {
+            RxDlcLostReported[obj_index] = RxDlcLostCount[obj_index];
+            /*
+             * [SWS_Can_00395] frames longer than the largest DLC of this HRH were dropped
+             */
+            #if(CanDevErrorDetect == STD_ON)
+                Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, CAN_MAIN_FUNCTION_READ_ID, CAN_E_DATALOST);
+            #endif
+        }
     }
 }
 
@@ -968,8 +1482,8 @@ void Can_MainFunction_Read(void)
 /*                                                                                      */
 /*****************************************************************************************/
 void Can_MainFunction_BusOff(void) {
-uint8 controllerId; /*variable to count controllers number*/
 #if(CanBusoffProcessing == POLLING)
+uint8 controllerId; /*variable to count controllers number*/
     /*
      *   Loop all controllers to get the new data
      */
@@ -1018,7 +1532,28 @@ Std_ReturnType Can_write (
 )
 {
     Std_ReturnType returnVal = E_NOT_OK ;
-	
+
+	/*
+	 *  local variable holds the index of the HTH in MessageObjAssignedToHTH[] array
+	 */
+	uint8 Hth_count = 0 ;
+
+	/*
+	 *      local variable to hold the data
+	 */
+	uint8 real_hwObjectId = 0 ;
+
+	/*
+	 *  local variable holds the controller ID of the HTH
+	 */
+	uint8 controllerId = 0 ;
+
+#if(CanHardwareCancellation == STD_ON)
+	/*
+	 *  local variable holds the message object whose lower priority L-PDU is cancelled
+	 */
+	uint8 cancel_hwObjectId = 0 ;
+#endif
 
     if (CAN_UNINIT == ModuleState)
     {
@@ -1026,8 +1561,6 @@ Std_ReturnType Can_write (
         #if (CanDevErrorDetect == STD_ON)
             // call Det function CAN_E_UNINIT
             Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_Write_Id, CAN_E_UNINIT);
-        #else
-            returnVal = E_NOT_OK ;
         #endif
     }
     else if (NULL_PTR == PduInfo)
@@ -1039,8 +1572,6 @@ Std_ReturnType Can_write (
          */
         #if (CanDevErrorDetect == STD_ON)
 		    Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_Write_Id, CAN_E_PARAM_POINTER);
-        #else
-		    returnVal = E_NOT_OK ;
         #endif
     }
     else if (PduInfo->length > 8 )
@@ -1052,11 +1583,9 @@ Std_ReturnType Can_write (
          */
         #if (CanDevErrorDetect == STD_ON)
 		Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_Write_Id, CAN_E_PARAM_DATA_LENGTH);
-        #else
-            returnVal = E_NOT_OK ;
         #endif
     }
-    else if (FALSE == CanTriggerTransmitEnable)
+    else if ((FALSE == CanTriggerTransmitEnable) && (NULL_PTR == PduInfo->sdu))
     {
         /*
          * [SWS_CAN_00505] ⌈ If development error detection for CanDrv is enabled:
@@ -1064,218 +1593,1425 @@ Std_ReturnType Can_write (
          * trigger transmit API is disabled for this hardware object (CanTriggerTransmitEnable =
          * FALSE) and the SDU pointer inside PduInfo is a null pointer.
          */
-        if (PduInfo->sdu == NULL_PTR)
-        {
-            returnVal = E_NOT_OK ;
+        #if (CanDevErrorDetect == STD_ON)
 			Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_Write_Id, CAN_E_PARAM_POINTER);
-        }
+        #endif
+    }
+    else if ((Hth >= CAN_HOH_NUMBER) || (TRANSMIT != HohHandleMap[Hth].ObjectType))
+    {
+        /*
+         * [SWS_Can_00217] If development error detection for the Can module is enabled:
+         * The function Can_Write shall raise the error CAN_E_PARAM_HANDLE and shall
+         * return E_NOT_OK if the parameter Hth is not a configured Hardware Transmit
+         * Handle.⌋
+         */
+        #if (CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_Write_Id, CAN_E_PARAM_HANDLE);
+        #endif
     }
     else
-	{
-	}
-	/* end of CanDevErrorDetect */
+    {
+        /*
+         * [SWS_Can_00212] ⌈ The function Can_Write shall perform following actions if the
+         * hardware transmit object is free:
+         * The mutex for that HTH is set to ‘signaled’
+         * The ID, Data Length and SDU are put in a format appropriate for the hardware
+         * (if necessary) and copied in the appropriate hardware registers/buffers.
+         * All necessary control operations to initiate the transmit are done
+         * The mutex for that HTH is released
+         * The function returns with E_OK⌋ (SRS_Can_01049)
+         * The mutex is the claim of one message object of the pool, taken with LDREX/STREX
+         * so that concurrent callers of the same HTH use different message objects.
+         */
+
+        /* Resolve the HTH and its hardware message objects from the tables built by Can_Init */
+        Hth_count       = HohHandleMap[Hth].Index ;
+        controllerId    = MessageObjAssignedToHTH[Hth_count].ControllerId ;
+
+        /* The message object is written through IF1, when a preempted task uses IF1 the
+         * L-PDU is queued */
+        if (TRUE == AcquireTaskIf(controllerId))
+        {
+            /*
+             * A new L-PDU only takes a free message object directly when nothing is queued,
+             * otherwise it is queued so that the L-PDU with the lowest ID is sent first
+             */
+            if (0 == TxQueue[Hth_count].Count)
+            {
+                real_hwObjectId = ClaimTxMessageObject(Hth_count) ;
+            }
+
+#if(CanHardwareCancellation == STD_ON)
+            /*
+             * [SWS_Can_00286] ⌈ The Can module shall initiate a cancellation, when the hardware
+             * transmit object assigned by a HTH is busy and an L-PDU with higher priority is
+             * requested to be transmitted.⌋
+             * The new L-PDU shall also have a higher priority than all the queued ones. It
+             * is queued below and takes the message object once the cancellation is done.
+             */
+            if ((0 == real_hwObjectId) &&
+                (TxQueue[Hth_count].Count < CAN_TX_QUEUE_SIZE) &&
+                ((0 == TxQueue[Hth_count].Count) ||
+                 (PduInfo->id < TxQueue[Hth_count].Entry[TxQueue[Hth_count].Count - 1].id)))
+            {
+                cancel_hwObjectId = ClaimCancelTxMessageObject(Hth_count, PduInfo->id) ;
+            }
+
+            if (0 != cancel_hwObjectId)
+            {
+                CancelTxMessageObject(Hth_count, cancel_hwObjectId) ;
+            }
+#endif
+            if (0 != real_hwObjectId)
+            {
+                /* [SWS_Can_00504] E_NOT_OK when CanIf_TriggerTransmit gave no data */
+                returnVal = WriteTxMessageObject(Hth_count, CAN_IF_TASK, real_hwObjectId, PduInfo) ;
+            }
+            ReleaseTaskIf(controllerId) ;
+        }
+
+        if (0 == real_hwObjectId)
+        {
+            /* The queue of the HTH is also updated from the interrupt context */
+            SchM_Enter_Can_CAN_EXCLUSIVE_AREA_TX_QUEUE();
+            if (TxQueue[Hth_count].Count < CAN_TX_QUEUE_SIZE)
+            {
+                TxQueueInsert(Hth_count, PduInfo) ;
+                returnVal = E_OK ;
+            }
+            else
+            {
+                /*
+                 * the hardware transmit objects and the software queue are busy
+                 * [SWS_Can_00213] ⌈ The function Can_Write shall perform no actions if the
+                 * hardware transmit object is busy with another transmit request for an L-PDU:
+                 * 1. The transmission of the other L-PDU shall not be cancelled and the function
+                 * Can_Write is left without any actions.
+                 * 2. The function Can_Write shall return CAN_BUSY. (SRS_Can_01049).
+                 */
+                returnVal = CAN_BUSY ;
+            }
+            SchM_Exit_Can_CAN_EXCLUSIVE_AREA_TX_QUEUE();
+
+            /* A message object may have been freed since the pool was found busy, when the
+             * IF1 registers are owned by a preempted task it drains the queue itself */
+            if (TRUE == AcquireTaskIf(controllerId))
+            {
+                TxQueueDrain(Hth_count, CAN_IF_TASK) ;
+                ReleaseTaskIf(controllerId) ;
+            }
+        }
+    }
+
+    return returnVal ;
+}
+
+/************************************************************************************
+* Service Name: Can_WriteBatch
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (Thread-safe)
+* Parameters (in): Hth      :   array of the HW-transmit handles used for each L-PDU
+*                  PduInfo  :   array of the L-PDUs to transmit
+*                  Count    :   number of entries in Hth, PduInfo and Result
+* Parameters (inout): None
+* Parameters (out): Result  :   result of each L-PDU, with the same meaning as the
+*                               return value of Can_write
+* Return value: Std_ReturnType E_NOT_OK if the module or the arrays are not valid
+* Description: Passes several CAN messages to CanDrv for transmission. All the L-PDUs
+*              are written in one exclusive area and the IF1 command registers are
+*              only written when the controller changes. Hardware cancellation is not
+*              done here, an L-PDU finding its HTH busy is queued. The message objects
+*              of the L-PDUs with a NULL_PTR sdu are only claimed in the exclusive area,
+*              CanIf_TriggerTransmit is called and they are loaded once it is left.
+************************************************************************************/
+Std_ReturnType Can_WriteBatch (
+        const Can_HwHandleType Hth[],
+        const Can_PduType PduInfo[],
+        uint8 Count,
+        Std_ReturnType Result[]
+)
+{
+    Std_ReturnType returnVal = E_NOT_OK ;
+
 	/*
-	 * [SWS_Can_00212] ⌈ The function Can_Write shall perform following actions if the
-	 * hardware transmit object is free:
-	 * The mutex for that HTH is set to ‘signaled’
-	 * The ID, Data Length and SDU are put in a format appropriate for the hardware
-	 * (if necessary) and copied in the appropriate hardware registers/buffers.
-	 * All necessary control operations to initiate the transmit are done
-	 * The mutex for that HTH is released
-	 * The function returns with E_OK⌋ (SRS_Can_01049)
+	 *  controllers whose IF1 registers are owned, and the one whose command registers are written
 	 */
+	uint32 IfOwnedMask = 0 ;
+	uint8 LoadedController = CAN_OBJECT_UNUSED ;
+	uint8 controllerId = 0 ;
+	uint8 Hth_count = 0 ;
+	uint8 real_hwObjectId = 0 ;
+	uint8 index = 0 ;
+	uint8 HW_Obj_Index = 0 ;
 
 	/*
-	 * Prepare the variables to be put in the following registers:
-	 * * Command Mask
-	 * * Mask 1
-	 * * Mask 2
-	 * * Arbitration 1
-	 * * Arbitration 2
-	 * * Message Control
-	 *
-	 * All 16 bits
+	 *  message objects claimed for the L-PDUs whose data is given by CanIf_TriggerTransmit,
+	 *  and the index of their L-PDU in PduInfo
 	 */
+	uint32 TriggerObjects[MAX_CONTROLLERS_NUMBER] = {0} ;
+	uint8 TriggerEntry[MAX_CONTROLLERS_NUMBER][CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS] ;
+
+    if (CAN_UNINIT == ModuleState)
+    {
+        #if (CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_WriteBatch_Id, CAN_E_UNINIT);
+        #endif
+    }
+    else if ((NULL_PTR == Hth) || (NULL_PTR == PduInfo) || (NULL_PTR == Result))
+    {
+        #if (CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_WriteBatch_Id, CAN_E_PARAM_POINTER);
+        #endif
+    }
+    else
+    {
+        /* The IF1 registers, the pools and the queues are not touched by the CAN interrupt
+         * until the whole batch is written */
+        SchM_Enter_Can_CAN_EXCLUSIVE_AREA_TX_QUEUE();
+
+        for (index = 0 ; index < Count ; index++)
+        {
+            Result[index] = E_NOT_OK ;
+
+            if (PduInfo[index].length > 8)
+            {
+                #if (CanDevErrorDetect == STD_ON)
+                    Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_WriteBatch_Id, CAN_E_PARAM_DATA_LENGTH);
+                #endif
+            }
+            else if ((FALSE == CanTriggerTransmitEnable) && (NULL_PTR == PduInfo[index].sdu))
+            {
+                #if (CanDevErrorDetect == STD_ON)
+                    Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_WriteBatch_Id, CAN_E_PARAM_POINTER);
+                #endif
+            }
+            else if ((Hth[index] >= CAN_HOH_NUMBER) || (TRANSMIT != HohHandleMap[Hth[index]].ObjectType))
+            {
+                #if (CanDevErrorDetect == STD_ON)
+                    Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_WriteBatch_Id, CAN_E_PARAM_HANDLE);
+                #endif
+            }
+            else
+            {
+                Hth_count = HohHandleMap[Hth[index]].Index ;
+                real_hwObjectId = 0 ;
+
+                controllerId = MessageObjAssignedToHTH[Hth_count].ControllerId ;
+
+                /* Take the IF1 registers of the controller of this L-PDU, a preempted
+                 * task may keep them, then the L-PDU is queued */
+                if ((0 == (IfOwnedMask & ((uint32)1 << controllerId))) &&
+                    (TRUE == AcquireTaskIf(controllerId)))
+                {
+                    IfOwnedMask |= (uint32)1 << controllerId ;
+                }
+
+                if ((controllerId != LoadedController) && (0 != (IfOwnedMask & ((uint32)1 << controllerId))))
+                {
+                    SetTxCommandRegisters(MessageObjAssignedToHTH[Hth_count].BaseAddress + CAN_IF_TASK) ;
+                    LoadedController = controllerId ;
+                }
+
+                if ((0 != (IfOwnedMask & ((uint32)1 << controllerId))) && (0 == TxQueue[Hth_count].Count))
+                {
+                    real_hwObjectId = ClaimTxMessageObject(Hth_count) ;
+                }
+
+                if ((0 != real_hwObjectId) && (NULL_PTR == PduInfo[index].sdu))
+                {
+                    /* The upper layer is not called with the interrupts masked */
+                    TriggerObjects[controllerId] |= (uint32)1 << (real_hwObjectId - 1) ;
+                    TriggerEntry[controllerId][real_hwObjectId - 1] = index ;
+                }
+                else if (0 != real_hwObjectId)
+                {
+                    Result[index] = LoadTxMessageObject(Hth_count, CAN_IF_TASK, real_hwObjectId, &PduInfo[index]) ;
+                    if (E_OK == Result[index])
+                    {
+                        (void)AtomicSetBits(&MessageObjAssignedToHTH[Hth_count].Tx_Request,
+                                            (uint32)1 << (real_hwObjectId - 1)) ;
+                        TakeSentTxMessageObject(Hth_count, real_hwObjectId - 1,
+                                                &MessageObjAssignedToHTH[Hth_count].Tx_Request) ;
+                    }
+                }
+                else if (TxQueue[Hth_count].Count < CAN_TX_QUEUE_SIZE)
+                {
+                    TxQueueInsert(Hth_count, &PduInfo[index]) ;
+                    Result[index] = E_OK ;
+                }
+                else
+                {
+                    Result[index] = CAN_BUSY ;
+                }
+            }
+        }
+
+        SchM_Exit_Can_CAN_EXCLUSIVE_AREA_TX_QUEUE();
+
+        /* The claimed message objects stay owned, their data is requested now */
+        for (controllerId = 0 ; controllerId < MAX_CONTROLLERS_NUMBER ; controllerId++)
+        {
+            if (0 != TriggerObjects[controllerId])
+            {
+                SetTxCommandRegisters(Global_Config->CanControllerCfgRef[controllerId].CanControllerBaseAddress + CAN_IF_TASK) ;
+            }
+            while (0 != TriggerObjects[controllerId])
+            {
+                HW_Obj_Index = (uint8)__CLZ(__RBIT(TriggerObjects[controllerId])) ;
+                TriggerObjects[controllerId] &= (TriggerObjects[controllerId] - 1) ;
+
+                index = TriggerEntry[controllerId][HW_Obj_Index] ;
+                Hth_count = MessageObjMap[controllerId][HW_Obj_Index].Index ;
+                Result[index] = LoadTxMessageObject(Hth_count, CAN_IF_TASK, HW_Obj_Index + 1, &PduInfo[index]) ;
+                if (E_OK == Result[index])
+                {
+                    (void)AtomicSetBits(&MessageObjAssignedToHTH[Hth_count].Tx_Request,
+                                        (uint32)1 << HW_Obj_Index) ;
+                    TakeSentTxMessageObject(Hth_count, HW_Obj_Index,
+                                            &MessageObjAssignedToHTH[Hth_count].Tx_Request) ;
+                }
+            }
+        }
+
+        /* Released out of the exclusive area as it may drain the queues */
+        for (controllerId = 0 ; controllerId < MAX_CONTROLLERS_NUMBER ; controllerId++)
+        {
+            if (0 != (IfOwnedMask & ((uint32)1 << controllerId)))
+            {
+                ReleaseTaskIf(controllerId) ;
+            }
+        }
+        returnVal = E_OK ;
+    }
+
+    return returnVal ;
+}
+
+#if(CanRxBufferLoan == STD_ON)
+/************************************************************************************
+* Service Name: Can_ReleaseRxBuffer
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant (Thread-safe)
+* Parameters (in): SduDataPtr  :   SduDataPtr given to CanIf_RxIndication
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Gives back the receive buffer lent with a frame. The data of the frame
+*              is valid from CanIf_RxIndication until this call, the buffer may be
+*              given back from any task or interrupt.
+************************************************************************************/
+void Can_ReleaseRxBuffer ( const uint8 * SduDataPtr )
+{
+    uint32 BufferIndex = 0 ;
+
+    if (CAN_UNINIT == ModuleState)
+    {
+        #if (CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_ReleaseRxBuffer_Id, CAN_E_UNINIT);
+        #endif
+    }
+    else if ((SduDataPtr < RxBufferPool[0]) ||
+             (SduDataPtr >= RxBufferPool[CAN_RX_BUFFER_POOL_SIZE - 1] + MAX_DATA_LENGTH) ||
+             (0 != ((uint32)(SduDataPtr - RxBufferPool[0]) % MAX_DATA_LENGTH)))
+    {
+        /* The pointer is not the start of a buffer of the pool */
+        #if (CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_ReleaseRxBuffer_Id, CAN_E_PARAM_POINTER);
+        #endif
+    }
+    else
+    {
+        BufferIndex = (uint32)(SduDataPtr - RxBufferPool[0]) / MAX_DATA_LENGTH ;
+        (void)AtomicSetBits(&RxBufferFree, (uint32)1 << BufferIndex) ;
+    }
+}
+#endif
+
+/************************************************************************************
+* Function Name: AtomicSetBits
+* Parameters (in): Address  :  word to update
+*                  Bits     :  bits to set
+* Return value: value of the word before the update
+* Description: Sets bits of a word shared with the interrupts using the exclusive
+*              monitor, the update is retried when the STREX fails.
+************************************************************************************/
+static uint32 AtomicSetBits(volatile uint32 * Address, uint32 Bits)
+{
+    uint32 OldValue = 0 ;
+
+    do
+    {
+        OldValue = __LDREXW((volatile uint32_t *)Address) ;
+    } while (0 != __STREXW(OldValue | Bits, (volatile uint32_t *)Address)) ;
+
+    return OldValue ;
+}
+
+/************************************************************************************
+* Function Name: AtomicClearBits
+* Parameters (in): Address  :  word to update
+*                  Bits     :  bits to clear
+* Return value: value of the word before the update
+* Description: Clears bits of a word shared with the interrupts using the exclusive
+*              monitor, the update is retried when the STREX fails.
+************************************************************************************/
+static uint32 AtomicClearBits(volatile uint32 * Address, uint32 Bits)
+{
+    uint32 OldValue = 0 ;
+
+    do
+    {
+        OldValue = __LDREXW((volatile uint32_t *)Address) ;
+    } while (0 != __STREXW(OldValue & ~Bits, (volatile uint32_t *)Address)) ;
+
+    return OldValue ;
+}
+
+/************************************************************************************
+* Function Name: ClaimTxMessageObject
+* Parameters (in): Hth_count :  index of the HTH in MessageObjAssignedToHTH[]
+* Return value: message object number claimed, 0 if the whole pool is busy
+* Description: Claims the lowest free message object of the pool of an HTH. The claim
+*              is an LDREX/STREX update of Tx_Claimed, so it is safe against the
+*              interrupts and the preempting tasks without disabling the interrupts.
+************************************************************************************/
+static uint8 ClaimTxMessageObject(uint8 Hth_count)
+{
+    volatile uint32 * Claimed = &MessageObjAssignedToHTH[Hth_count].Tx_Claimed ;
+    uint32 ui32Base = MessageObjAssignedToHTH[Hth_count].BaseAddress ;
+    uint32 ClaimedObjects = 0 ;
+    uint32 FreeObjects = 0 ;
+    uint8  real_hwObjectId = 0 ;
+
+    do
+    {
+        real_hwObjectId = 0 ;
+        ClaimedObjects = __LDREXW((volatile uint32_t *)Claimed) ;
+
+        /*
+         * A message object of the pool is free when its TXRQST bit in CANTXRQ1/2 is
+         * cleared and nobody claimed it, a claim lasts until the confirmation
+         */
+        FreeObjects = MessageObjAssignedToHTH[Hth_count].PoolMask &
+                      ~(HWREG(ui32Base + CAN_O_TXRQ1) | (HWREG(ui32Base + CAN_O_TXRQ2) << 16)) &
+                      ~ClaimedObjects ;
+
+        if (0 == FreeObjects)
+        {
+            __CLREX() ;
+            break ;
+        }
+
+        real_hwObjectId = (uint8)__CLZ(__RBIT(FreeObjects)) + 1 ;
+    } while (0 != __STREXW(ClaimedObjects | ((uint32)1 << (real_hwObjectId - 1)), (volatile uint32_t *)Claimed)) ;
+
+    return real_hwObjectId ;
+}
+
+#if(CanRxBufferLoan == STD_ON)
+/************************************************************************************
+* Function Name: TakeRxBuffer
+* Parameters (in): None
+* Return value: buffer taken from RxBufferPool, NULL_PTR if all the buffers are lent
+* Description: Takes the lowest free receive buffer. Like the claim of the transmit
+*              message objects it is an LDREX/STREX update, so the interrupt and the
+*              tasks can take buffers while the upper layer gives others back.
+************************************************************************************/
+static uint8 * TakeRxBuffer(void)
+{
+    uint32 FreeBuffers = 0 ;
+    uint8  BufferIndex = 0 ;
+    uint8 * Buffer = NULL_PTR ;
+
+    do
+    {
+        Buffer = NULL_PTR ;
+        FreeBuffers = __LDREXW((volatile uint32_t *)&RxBufferFree) ;
+
+        if (0 == FreeBuffers)
+        {
+            __CLREX() ;
+            break ;
+        }
+
+        BufferIndex = (uint8)__CLZ(__RBIT(FreeBuffers)) ;
+        Buffer = RxBufferPool[BufferIndex] ;
+    } while (0 != __STREXW(FreeBuffers & ~((uint32)1 << BufferIndex), (volatile uint32_t *)&RxBufferFree)) ;
+
+    return Buffer ;
+}
+#endif
+
+/************************************************************************************
+* Function Name: ReleaseTxMessageObject
+* Parameters (in): Hth_count     :  index of the HTH in MessageObjAssignedToHTH[]
+*                  HW_Obj_Index  :  message object number - 1
+* Return value: None
+* Description: Makes a message object of the pool free again once its request was
+*              confirmed or cancelled.
+************************************************************************************/
+static void ReleaseTxMessageObject(uint8 Hth_count, uint8 HW_Obj_Index)
+{
+    (void)AtomicClearBits(&MessageObjAssignedToHTH[Hth_count].Tx_Claimed, (uint32)1 << HW_Obj_Index) ;
+}
+
+/************************************************************************************
+* Function Name: ConfirmTxMessageObject
+* Parameters (in): Hth_count     :  index of the HTH in MessageObjAssignedToHTH[]
+*                  HW_Obj_Index  :  message object number - 1
+* Return value: None
+* Description: Confirms the L-PDU of a sent message object to CanIf and frees the
+*              object. With CanInterruptBottomHalf the confirmation is latched in
+*              Tx_Done for PendSV_Handler and the object stays claimed until then.
+************************************************************************************/
+static void ConfirmTxMessageObject(uint8 Hth_count, uint8 HW_Obj_Index)
+{
+#if(CanTimeStampEnable == STD_ON)
+    uint64 TimeStamp = 0 ;
+
+    CAN_GET_TIMESTAMP(TimeStamp) ;
+#endif
+
+#if(CanInterruptBottomHalf == STD_ON)
+#if(CanTimeStampEnable == STD_ON)
+    TxDoneTimeStamp[MessageObjAssignedToHTH[Hth_count].ControllerId][HW_Obj_Index] = TimeStamp ;
+#endif
+    (void)AtomicSetBits(&MessageObjAssignedToHTH[Hth_count].Tx_Done, (uint32)1 << HW_Obj_Index) ;
+    CAN_PEND_BOTTOM_HALF() ;
+#else
+    CAN_TX_CONFIRMATION(swPduHandle[MessageObjAssignedToHTH[Hth_count].ControllerId][HW_Obj_Index], TimeStamp) ;
+    ReleaseTxMessageObject(Hth_count, HW_Obj_Index) ;
+#endif
+}
+
+/************************************************************************************
+* Function Name: TakeSentTxMessageObject
+* Parameters (in): Hth_count     :  index of the HTH in MessageObjAssignedToHTH[]
+*                  HW_Obj_Index  :  message object number - 1
+*                  Owner         :  Tx_Request of the HTH, where the caller just set
+*                                   the bit of the message object
+* Return value: None
+* Description: Confirms the L-PDU of a message object that was sent before the caller
+*              marked it in Owner. The interrupt of such a frame, e.g. when the task is
+*              preempted for longer than one frame between the transfer to the message
+*              RAM and the update of Owner, found the object claimed but not marked and
+*              latched it in Tx_Sent. When the interrupt comes after the update it
+*              confirms the object itself, so only one of them clears the bit of Owner.
+************************************************************************************/
+static void TakeSentTxMessageObject(uint8 Hth_count, uint8 HW_Obj_Index, volatile uint32 * Owner)
+{
+    uint32 ObjectBit = (uint32)1 << HW_Obj_Index ;
+
+    if ((0 != (AtomicClearBits(&MessageObjAssignedToHTH[Hth_count].Tx_Sent, ObjectBit) & ObjectBit)) &&
+        (0 != (AtomicClearBits(Owner, ObjectBit) & ObjectBit)))
+    {
+        ConfirmTxMessageObject(Hth_count, HW_Obj_Index) ;
+    }
+}
+
+/************************************************************************************
+* Function Name: AcquireTaskIf
+* Parameters (in): ControllerId  :  controller whose IF1 registers are needed
+* Return value: TRUE when the IF1 registers are now owned by the caller
+* Description: Takes the IF1 registers of a controller for a task level function without
+*              waiting, it fails when a preempted task owns them.
+************************************************************************************/
+static boolean AcquireTaskIf(uint8 ControllerId)
+{
+    boolean Acquired = TRUE ;
+
+    if (AtomicSetBits(&TaskIfOwned, (uint32)1 << ControllerId) & ((uint32)1 << ControllerId))
+    {
+        (void)AtomicSetBits(&TaskIfMissed, (uint32)1 << ControllerId) ;
+        Acquired = FALSE ;
+    }
+
+    return Acquired ;
+}
 
-	uint16 ui16CmdMaskReg   = 0 ;
-	uint16 ui16MaskReg_1    = 0 ;
-	uint16 ui16MaskReg_2    = 0 ;
+/************************************************************************************
+* Function Name: ReleaseTaskIf
+* Parameters (in): ControllerId  :  controller whose IF1 registers were acquired
+* Return value: None
+* Description: Gives back the IF1 registers of a controller. The L-PDUs queued by the
+*              tasks that could not take them meanwhile are then moved to the hardware.
+************************************************************************************/
+static void ReleaseTaskIf(uint8 ControllerId)
+{
+    uint32 ControllerMask = (uint32)1 << ControllerId ;
+    uint8 Hth_count = 0 ;
+    boolean Owned = TRUE ;
+
+    while (TRUE == Owned)
+    {
+        /* Drain while still owning the IF1 registers */
+        while (AtomicClearBits(&TaskIfMissed, ControllerMask) & ControllerMask)
+        {
+            for (Hth_count = 0 ; Hth_count < CAN_HTH_NUMBER ; Hth_count++)
+            {
+                if ((MessageObjAssignedToHTH[Hth_count].ControllerId == ControllerId) &&
+                    (0 != TxQueue[Hth_count].Count))
+                {
+                    TxQueueDrain(Hth_count, CAN_IF_TASK) ;
+                }
+            }
+        }
+
+        (void)AtomicClearBits(&TaskIfOwned, ControllerMask) ;
+
+        /* A task may have missed the registers between the last drain and the release,
+         * take them back for it unless another task already did */
+        Owned = FALSE ;
+        if ((0 != (TaskIfMissed & ControllerMask)) &&
+            (0 == (AtomicSetBits(&TaskIfOwned, ControllerMask) & ControllerMask)))
+        {
+            Owned = TRUE ;
+        }
+    }
+}
+
+/************************************************************************************
+* Function Name: SetTxCommandRegisters
+* Parameters (in): IfBase  :  base address of the CAN controller plus CAN_IF_TASK or
+*                             CAN_IF_ISR
+* Return value: None
+* Description: Writes the command mask and mask registers of an interface register set
+*              used to write a transmit message object. They keep their value between two
+*              transfers, so they are written once for several message objects.
+************************************************************************************/
+static void SetTxCommandRegisters(uint32 IfBase)
+{
+    /* Wait for the previous transfer of the interface registers to finish */
+    while(HWREG(IfBase + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+    {
+    }
+
+    HWREG(IfBase + CAN_O_IF1CMSK) = CAN_IF1CMSK_WRNRD | CAN_IF1CMSK_DATAA |
+                                    CAN_IF1CMSK_DATAB | CAN_IF1CMSK_CONTROL|
+                                    CAN_IF1CMSK_ARB ;
+    HWREG(IfBase + CAN_O_IF1MSK1) = 0 ;
+    HWREG(IfBase + CAN_O_IF1MSK2) = 0 ;
+}
+
+/************************************************************************************
+* Function Name: LoadTxMessageObject
+* Parameters (in): Hth_count        :  index of the HTH in MessageObjAssignedToHTH[]
+*                  IfOffset         :  CAN_IF_TASK or CAN_IF_ISR
+*                  real_hwObjectId  :  message object claimed by ClaimTxMessageObject
+*                  PduInfo          :  L-PDU to transmit, a NULL_PTR sdu requests the data
+*                                      with CanIf_TriggerTransmit
+* Return value: E_OK when the transmission is requested, E_NOT_OK when CanIf_TriggerTransmit
+*               gave no data, the message object is then released
+* Description: Copies the L-PDU into the claimed message object and requests its
+*              transmission. SetTxCommandRegisters shall have been called before.
+************************************************************************************/
+static Std_ReturnType LoadTxMessageObject(uint8 Hth_count, uint32 IfOffset, uint8 real_hwObjectId, const Can_PduType * PduInfo)
+{
+	/*
+	 * Arbitration 1, Arbitration 2 and Message Control values, made of the images
+	 * precomputed by Can_Init with the ID and the DLC of the L-PDU
+	 */
 	uint16 ui16ArbReg_1     = 0 ;
 	uint16 ui16ArbReg_2     = 0 ;
 	uint16 ui16MsgCtrl      = 0 ;
 
-	/*
-	 *  variable to hold the base address of a can controller
-	 */
-	uint32 ui32Base = 0 ;
+	const str_MessageObjAssignedToHTH * HthObj = &MessageObjAssignedToHTH[Hth_count] ;
+	uint32 IfBase = HthObj->BaseAddress + IfOffset ;
+	uint8  controllerId = HthObj->ControllerId ;
 
 	/*
-	 * local variable points to the transmit HW object that the interface wants to use.
+	 *  data and length of the L-PDU, given by CanIf_TriggerTransmit when the sdu is NULL_PTR
 	 */
-	uint8 hth_index = 0 ;
+	uint8 * sdu = PduInfo->sdu ;
+	uint8 length = PduInfo->length ;
+#if(CanTriggerTransmitEnable == TRUE)
+	uint8 Data[MAX_DATA_LENGTH] ;
+	PduInfoType TriggerPduInfo ;
 
-	/*
-	 *  local variable used as a counter to loop on MessageObjAssignedToHTH[] array
-	 */
-	uint8 Hth_count = 0 ;
+    if (NULL_PTR == sdu)
+    {
+        /*
+         * [SWS_Can_00503] ⌈ Can_Write() shall interpret a null pointer as SDU as request
+         * for using the trigger transmit interface. If so and the hardware object is free,
+         * Can_Write() shall call CanIf_TriggerTransmit() with the maximum size of the
+         * message buffer to acquire the PDU's data.⌋
+         * The data is requested once the message object is claimed, so a queued L-PDU is
+         * sent with the latest values of its signals
+         */
+        TriggerPduInfo.SduDataPtr = Data ;
+        TriggerPduInfo.SduLength = length ;
+        if ((E_OK != CanIf_TriggerTransmit(PduInfo->swPduHandle, &TriggerPduInfo)) ||
+            (TriggerPduInfo.SduLength > length))
+        {
+            ReleaseTxMessageObject(Hth_count, real_hwObjectId - 1) ;
+            return E_NOT_OK ;
+        }
+        sdu = Data ;
+        length = (uint8)TriggerPduInfo.SduLength ;
+    }
+#endif
 
-	/*
-	 * local variable used as a counter to loop on CanHardwareObjectRef elements to detect info about the Hw object needed.
-	 */
-	uint8 Hoh_count = 0 ;
+    if (HthObj->Arb2Image & CAN_IF1ARB2_XTD)
+    {
+        ui16ArbReg_1 = PduInfo->id & CAN_IF1ARB1_ID_M ;
+        ui16ArbReg_2 = HthObj->Arb2Image | ((PduInfo->id >> 16) & CAN_IF1ARB2_ID_M) ;
+    }
+    else
+    {
+        ui16ArbReg_2 = HthObj->Arb2Image | ((PduInfo->id << 2) & CAN_IF1ARB2_ID_STAND) ;
+    }
+    ui16MsgCtrl = HthObj->MsgCtrlImage | (length & CAN_IF1MCTL_DLC_M) ;
 
-	/*
-	 *      local variable to hold the data
-	 */
-	uint8 real_hwObjectId = 0 ;
+    /* Wait for the previous transfer of the interface registers to finish */
+    while(HWREG(IfBase + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+    {
+    }
 
-	for (Hoh_count = 0 ; Hoh_count < CAN_HOH_NUMBER  ; Hoh_count++)
-	{
-	    if (Hth == Global_Config->CanHardwareObjectRef[Hoh_count].CanObjectId)
-		{
-			hth_index = Hoh_count ;
-			break ;
-		}
-	}
-        #if (CanDevErrorDetect == STD_ON)
-            /*
-             * [SWS_Can_00217] If development error detection for the Can module is enabled:
-             * The function Can_Write shall raise the error CAN_E_PARAM_HANDLE and shall
-             * return E_NOT_OK if the parameter Hth is not a configured Hardware Transmit
-             * Handle.⌋
-             */
-            if (Global_Config->CanHardwareObjectRef[hth_index].CanObjectType != TRANSMIT)
+    CANDataRegSet (
+            sdu,
+            (uint32 *)( IfBase + CAN_O_IF1DA1 ),
+            length
+    );
+
+    HWREG(IfBase + CAN_O_IF1ARB1) = ui16ArbReg_1;
+    HWREG(IfBase + CAN_O_IF1ARB2) = ui16ArbReg_2;
+    HWREG(IfBase + CAN_O_IF1MCTL) = ui16MsgCtrl;
+
+    /*
+     *  [SWS_Can_00276] ⌈ The function Can_Write shall store the swPduHandle that is
+        given inside the parameter PduInfo until the Can module calls the
+        CanIf_TxConfirmation for this request where the swPduHandle is given as
+        parameter.()
+     */
+    swPduHandle[controllerId][real_hwObjectId - 1] = PduInfo->swPduHandle ;
+#if(CanHardwareCancellation == STD_ON)
+    TxPendingId[controllerId][real_hwObjectId - 1] = PduInfo->id ;
+#endif
+
+    HWREG(IfBase + CAN_O_IF1CRQ) = real_hwObjectId ;
+
+    /* The TXRQST bit is set once the transfer to the message RAM is done, only then
+     * Can_MainFunction_Write may look for the end of the transmission */
+    while(HWREG(IfBase + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+    {
+    }
+
+    return E_OK ;
+}
+
+/************************************************************************************
+* Function Name: WriteTxMessageObject
+* Parameters (in): Hth_count        :  index of the HTH in MessageObjAssignedToHTH[]
+*                  IfOffset         :  CAN_IF_TASK or CAN_IF_ISR
+*                  real_hwObjectId  :  message object claimed by ClaimTxMessageObject
+*                  PduInfo          :  L-PDU to transmit
+* Return value: E_OK when the transmission is requested, E_NOT_OK when CanIf_TriggerTransmit
+*               gave no data
+* Description: Copies the L-PDU into the claimed message object, requests its
+*              transmission and marks the message object as pending.
+************************************************************************************/
+static Std_ReturnType WriteTxMessageObject(uint8 Hth_count, uint32 IfOffset, uint8 real_hwObjectId, const Can_PduType * PduInfo)
+{
+    Std_ReturnType returnVal = E_NOT_OK ;
+
+    SetTxCommandRegisters(MessageObjAssignedToHTH[Hth_count].BaseAddress + IfOffset) ;
+    returnVal = LoadTxMessageObject(Hth_count, IfOffset, real_hwObjectId, PduInfo) ;
+
+    if (E_OK == returnVal)
+    {
+        /* The message object stays claimed until its confirmation */
+        (void)AtomicSetBits(&MessageObjAssignedToHTH[Hth_count].Tx_Request, (uint32)1 << (real_hwObjectId - 1)) ;
+        TakeSentTxMessageObject(Hth_count, real_hwObjectId - 1, &MessageObjAssignedToHTH[Hth_count].Tx_Request) ;
+    }
+
+    return returnVal ;
+}
+
+#if(CanHardwareCancellation == STD_ON)
+/************************************************************************************
+* Function Name: ClaimCancelTxMessageObject
+* Parameters (in): Hth_count :  index of the HTH in MessageObjAssignedToHTH[]
+*                  id        :  CAN ID of the L-PDU requested for transmission
+* Return value: message object number claimed, 0 if no pending L-PDU has a lower priority
+* Description: Claims the message object of the pool holding the pending L-PDU with the
+*              lowest priority when it is lower than the priority of id. The object is
+*              no longer seen as pending and stays claimed, CancelTxMessageObject shall
+*              be called for it.
+************************************************************************************/
+static uint8 ClaimCancelTxMessageObject(uint8 Hth_count, Can_IdType id)
+{
+    uint8  controllerId = MessageObjAssignedToHTH[Hth_count].ControllerId ;
+    uint32 PendingObjects = MessageObjAssignedToHTH[Hth_count].Tx_Request ;
+    Can_IdType LowestPriorityId = id ;
+    uint8  HW_Obj_Index = 0 ;
+    uint8  real_hwObjectId = 0 ;
+
+    while (0 != PendingObjects)
+    {
+        HW_Obj_Index = (uint8)__CLZ(__RBIT(PendingObjects)) ;
+        PendingObjects &= (PendingObjects - 1) ;
+
+        if (TxPendingId[controllerId][HW_Obj_Index] > LowestPriorityId)
+        {
+            LowestPriorityId = TxPendingId[controllerId][HW_Obj_Index] ;
+            real_hwObjectId = HW_Obj_Index + 1 ;
+        }
+    }
+
+    /*
+     * Can_MainFunction_Write and the interrupt no longer confirm this object, when they
+     * confirmed it first the object is left to them
+     */
+    if ((0 != real_hwObjectId) &&
+        (0 == (AtomicClearBits(&MessageObjAssignedToHTH[Hth_count].Tx_Request, (uint32)1 << (real_hwObjectId - 1)) &
+               ((uint32)1 << (real_hwObjectId - 1)))))
+    {
+        real_hwObjectId = 0 ;
+    }
+
+    return real_hwObjectId ;
+}
+
+/************************************************************************************
+* Function Name: CancelTxMessageObject
+* Parameters (in): Hth_count        :  index of the HTH in MessageObjAssignedToHTH[]
+*                  real_hwObjectId  :  message object claimed by ClaimCancelTxMessageObject
+* Return value: None
+* Description: Clears the TXRQST bit of the message object through the IF1 registers
+*              and sets its TXIE bit, without waiting. A frame already moved to the
+*              shift register is still sent once TXRQST is cleared and only its INTPND
+*              tells it: the interrupt then confirms the L-PDU, else the cancellation
+*              is reported by Can_MainFunction_Write, see ResolveTxCancellations.
+************************************************************************************/
+static void CancelTxMessageObject(uint8 Hth_count, uint8 real_hwObjectId)
+{
+    str_MessageObjAssignedToHTH * HthObj = &MessageObjAssignedToHTH[Hth_count] ;
+    uint32 ui32Base = HthObj->BaseAddress ;
+    uint32 ObjectBit = (uint32)1 << (real_hwObjectId - 1) ;
+    uint16 ui16MsgCtrl = 0 ;
+    boolean Sent = FALSE ;
+
+    /* From now on the interrupt confirms a frame of the object as sent */
+    HthObj->Tx_CancelAged &= ~ObjectBit ;
+    (void)AtomicSetBits(&HthObj->Tx_Cancel, ObjectBit) ;
+
+    /*
+     * The CAN interrupt is held off for the read and the write of the control bits, so
+     * that it does not clear the INTPND of a frame sent in between. When the interrupt
+     * already confirmed the L-PDU the object may hold a new one, it is left alone
+     */
+    SchM_Enter_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
+    if (0 != (HthObj->Tx_Cancel & ObjectBit))
+    {
+        while(HWREG(ui32Base + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+        {
+        }
+        HWREG(ui32Base + CAN_O_IF1CMSK) = CAN_IF1CMSK_CONTROL ;
+        HWREG(ui32Base + CAN_O_IF1CRQ) = real_hwObjectId ;
+        while(HWREG(ui32Base + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+        {
+        }
+        ui16MsgCtrl = HWREG(ui32Base + CAN_O_IF1MCTL) ;
+
+        if (ui16MsgCtrl & CAN_IF1MCTL_TXRQST)
+        {
+            /* TXIE is set for the polled HTHs too, the new L-PDU written afterwards
+             * restores the control bits of the HTH */
+            HWREG(ui32Base + CAN_O_IF1MCTL) = (ui16MsgCtrl & ~CAN_IF1MCTL_TXRQST) | CAN_IF1MCTL_TXIE ;
+            HWREG(ui32Base + CAN_O_IF1CMSK) = CAN_IF1CMSK_WRNRD | CAN_IF1CMSK_CONTROL ;
+            HWREG(ui32Base + CAN_O_IF1CRQ) = real_hwObjectId ;
+        }
+        else if (0 == (ui16MsgCtrl & CAN_IF1MCTL_INTPND))
+        {
+            /* The L-PDU was sent before its request could be cleared and no interrupt
+             * reports it */
+            Sent = TRUE ;
+        }
+        else
+        {
+            /* The L-PDU was sent, the pending interrupt confirms it */
+        }
+    }
+    SchM_Exit_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
+
+    if ((TRUE == Sent) && (0 != (AtomicClearBits(&HthObj->Tx_Cancel, ObjectBit) & ObjectBit)))
+    {
+        ConfirmTxMessageObject(Hth_count, real_hwObjectId - 1) ;
+    }
+
+    /* The frame may also have been sent before Tx_Cancel was set */
+    TakeSentTxMessageObject(Hth_count, real_hwObjectId - 1, &HthObj->Tx_Cancel) ;
+}
+
+/************************************************************************************
+* Function Name: ResolveTxCancellations
+* Parameters (in): Hth_count :  index of the HTH in MessageObjAssignedToHTH[]
+* Return value: None
+* Description: Finishes the cancellations started by CancelTxMessageObject, the caller
+*              owns the IF1 registers. A message object whose INTPND is set was sent
+*              and its L-PDU is confirmed. One found without INTPND by the previous
+*              call too, a period of Can_MainFunction_Write later, cannot hold a frame
+*              on the bus any more: its TXIE bit is cleared and the cancelled L-PDU is
+*              given back to CanIf with the data read from the object.
+************************************************************************************/
+static void ResolveTxCancellations(uint8 Hth_count)
+{
+    str_MessageObjAssignedToHTH * HthObj = &MessageObjAssignedToHTH[Hth_count] ;
+    uint32 ui32Base = HthObj->BaseAddress ;
+    uint8  controllerId = HthObj->ControllerId ;
+    uint32 Cancelled = HthObj->Tx_Cancel ;
+    uint32 ObjectBit = 0 ;
+    uint8  HW_Obj_Index = 0 ;
+    uint16 ui16MsgCtrl = 0 ;
+    boolean Sent = FALSE ;
+    boolean Aged = FALSE ;
+    PduInfoType PduInfo ;
+    uint8 Data[MAX_DATA_LENGTH] ;
+
+    /* Cancellations finished by the interrupt meanwhile are not aged any more */
+    HthObj->Tx_CancelAged &= Cancelled ;
+
+    while (0 != Cancelled)
+    {
+        HW_Obj_Index = (uint8)__CLZ(__RBIT(Cancelled)) ;
+        Cancelled &= (Cancelled - 1) ;
+        ObjectBit = (uint32)1 << HW_Obj_Index ;
+        Sent = FALSE ;
+        Aged = FALSE ;
+
+        /* The interrupt neither clears INTPND nor frees the object in between */
+        SchM_Enter_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
+        if (0 != (HthObj->Tx_Cancel & ObjectBit))
+        {
+            while(HWREG(ui32Base + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+            {
+            }
+            HWREG(ui32Base + CAN_O_IF1CMSK) = CAN_IF1CMSK_CONTROL | CAN_IF1CMSK_CLRINTPND |
+                                              CAN_IF1CMSK_DATAA | CAN_IF1CMSK_DATAB ;
+            HWREG(ui32Base + CAN_O_IF1CRQ) = HW_Obj_Index + 1 ;
+            while(HWREG(ui32Base + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
             {
-                returnVal = E_NOT_OK ;
-                //det error CAN_E_PARAM_HANDLE
-                Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_Write_Id, CAN_E_PARAM_HANDLE);
+            }
+            ui16MsgCtrl = HWREG(ui32Base + CAN_O_IF1MCTL) ;
+
+            if (ui16MsgCtrl & CAN_IF1MCTL_INTPND)
+            {
+                Sent = TRUE ;
+            }
+            else if (0 != (HthObj->Tx_CancelAged & ObjectBit))
+            {
+                PduInfo.SduLength = ui16MsgCtrl & CAN_IF1MCTL_DLC_M ;
+                CANDataRegGet( Data ,(uint32*)( ui32Base + CAN_O_IF1DA1), PduInfo.SduLength) ;
+                PduInfo.SduDataPtr = Data ;
+
+                /* No interrupt of this object may come any more */
+                HWREG(ui32Base + CAN_O_IF1MCTL) = ui16MsgCtrl & ~(CAN_IF1MCTL_TXRQST | CAN_IF1MCTL_TXIE) ;
+                HWREG(ui32Base + CAN_O_IF1CMSK) = CAN_IF1CMSK_WRNRD | CAN_IF1CMSK_CONTROL ;
+                HWREG(ui32Base + CAN_O_IF1CRQ) = HW_Obj_Index + 1 ;
+                Aged = TRUE ;
             }
             else
             {
-                /*MISRA Rule*/
+                /* The frame may still be on the bus */
+                HthObj->Tx_CancelAged |= ObjectBit ;
             }
-        #endif
-        if (0 == HTH_Semaphore[hth_index])
+        }
+        SchM_Exit_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
+
+        if (((TRUE == Sent) || (TRUE == Aged)) &&
+            (0 != (AtomicClearBits(&HthObj->Tx_Cancel, ObjectBit) & ObjectBit)))
         {
-            HTH_Semaphore[hth_index] = 1 ;
+            HthObj->Tx_CancelAged &= ~ObjectBit ;
+            if (TRUE == Sent)
+            {
+                ConfirmTxMessageObject(Hth_count, HW_Obj_Index) ;
+            }
+            else
+            {
+                /* [SWS_Can_00287] report the cancelled L-PDU so that CanIf can request it again */
+                CanIf_CancelTxConfirmation(swPduHandle[controllerId][HW_Obj_Index], &PduInfo) ;
+                ReleaseTxMessageObject(Hth_count, HW_Obj_Index) ;
+            }
+        }
+    }
+}
+#endif
 
-            ui32Base = Global_Config->CanHardwareObjectRef[hth_index].CanControllerRef->CanControllerBaseAddress ;
-            /*
-             * check if hardware is busy
-             */
-            if(HWREG(ui32Base + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+/************************************************************************************
+* Function Name: TxQueueInsert
+* Parameters (in): Hth_count :  index of the HTH in MessageObjAssignedToHTH[]
+*                  PduInfo   :  L-PDU to queue
+* Return value: None
+* Description: Copies the L-PDU into the software queue of the HTH keeping it sorted
+*              by descending CAN ID, L-PDUs with the same ID keep their order.
+*              Shall be called in CAN_EXCLUSIVE_AREA_TX_QUEUE with the queue not full.
+************************************************************************************/
+static void TxQueueInsert(uint8 Hth_count, const Can_PduType * PduInfo)
+{
+    str_TxQueue * Queue = &TxQueue[Hth_count] ;
+    uint8 position = Queue->Count ;
+    uint8 index = 0 ;
+
+    /* Move the L-PDUs with a lower ID one place towards the end of the queue */
+    while ((position > 0) && (Queue->Entry[position - 1].id < PduInfo->id))
+    {
+        Queue->Entry[position] = Queue->Entry[position - 1] ;
+        position-- ;
+    }
+
+    Queue->Entry[position].swPduHandle = PduInfo->swPduHandle ;
+    Queue->Entry[position].id = PduInfo->id ;
+    Queue->Entry[position].length = PduInfo->length ;
+    if (NULL_PTR == PduInfo->sdu)
+    {
+        /* The data is requested with CanIf_TriggerTransmit once the L-PDU leaves the queue */
+        Queue->Entry[position].TriggerTransmit = TRUE ;
+    }
+    else
+    {
+        Queue->Entry[position].TriggerTransmit = FALSE ;
+        for (index = 0 ; index < PduInfo->length ; index++)
+        {
+            Queue->Entry[position].sdu[index] = PduInfo->sdu[index] ;
+        }
+    }
+    Queue->Count++ ;
+}
+
+/************************************************************************************
+* Function Name: TxQueueDrain
+* Parameters (in): Hth_count :  index of the HTH in MessageObjAssignedToHTH[]
+*                  IfOffset  :  CAN_IF_ISR from Serve_Interrupts, CAN_IF_TASK from a
+*                               task that owns the IF1 registers of the controller
+* Return value: None
+* Description: Moves the queued L-PDUs of an HTH, lowest ID first, into the free
+*              message objects of its pool. Called from the task and interrupt context.
+************************************************************************************/
+static void TxQueueDrain(uint8 Hth_count, uint32 IfOffset)
+{
+    str_TxQueueEntry Entry ;
+    Can_PduType PduInfo ;
+    uint8 real_hwObjectId = 0 ;
+
+    do
+    {
+        real_hwObjectId = 0 ;
+
+        SchM_Enter_Can_CAN_EXCLUSIVE_AREA_TX_QUEUE();
+        if (0 != TxQueue[Hth_count].Count)
+        {
+            real_hwObjectId = ClaimTxMessageObject(Hth_count) ;
+            if (0 != real_hwObjectId)
             {
-                /*
-                 * the hardware transmit object is busy
-                 * [SWS_Can_00213] ⌈ The function Can_Write shall perform no actions if the
-                 * hardware transmit object is busy with another transmit request for an L-PDU:
-                 * 1. The transmission of the other L-PDU shall not be cancelled and the function
-                 * Can_Write is left without any actions.
-                 * 2. The function Can_Write shall return CAN_BUSY. (SRS_Can_01049).
-                 */
-                returnVal = CAN_BUSY ;
+                /* The L-PDU with the highest priority is the last entry of the queue */
+                TxQueue[Hth_count].Count-- ;
+                Entry = TxQueue[Hth_count].Entry[TxQueue[Hth_count].Count] ;
+            }
+        }
+        SchM_Exit_Can_CAN_EXCLUSIVE_AREA_TX_QUEUE();
+
+        if (0 != real_hwObjectId)
+        {
+            PduInfo.swPduHandle = Entry.swPduHandle ;
+            PduInfo.id = Entry.id ;
+            PduInfo.length = Entry.length ;
+            if (TRUE == Entry.TriggerTransmit)
+            {
+                PduInfo.sdu = NULL_PTR ;
             }
             else
             {
-                ui16CmdMaskReg |= CAN_IF1CMSK_WRNRD | CAN_IF1CMSK_DATAA |
-                                  CAN_IF1CMSK_DATAB | CAN_IF1CMSK_CONTROL|
-                                  CAN_IF1CMSK_ARB ;
+                PduInfo.sdu = Entry.sdu ;
+            }
+            /* An L-PDU whose data CanIf_TriggerTransmit does not give is dropped */
+            (void)WriteTxMessageObject(Hth_count, IfOffset, real_hwObjectId, &PduInfo) ;
+        }
+    } while (0 != real_hwObjectId) ;
+}
 
-                ui16ArbReg_2 = CAN_IF1ARB2_DIR;             /// transmit M.O.
+/************************************************************************************
+* Function Name: ReadRxFifo
+* Parameters (in): Hrh_count :  index of the HRH in MessageObjAssignedToHRH[]
+*                  IfOffset  :  CAN_IF_ISR from Serve_Interrupts, CAN_IF_TASK from a
+*                               task that owns the IF1 registers of the controller
+*                  TimeStamp :  time the frames were seen, given to the upper layer
+* Return value: number of frames read, the dropped ones included
+* Description: Reads the frames of the hardware FIFO of an HRH in their order of arrival.
+*              The controller stores a frame in the lowest FIFO object without NEWDAT, so
+*              the objects read keep NEWDAT until the FIFO is empty and are then released
+*              together, a frame received meanwhile can only go above them. The last object
+*              is released after the others, and a frame that overwrote it after it was read
+*              is counted as lost. The next call starts after the last object read, so
+*              frames left above it are read before the ones stored at the bottom of the
+*              FIFO after the release. A frame with more data bytes than MaxDlc is dropped
+*              and counted.
+************************************************************************************/
+static uint8 ReadRxFifo(uint8 Hrh_count, uint32 IfOffset, uint64 TimeStamp)
+{
+    str_MessageObjAssignedToHRH * HrhObj = &MessageObjAssignedToHRH[Hrh_count] ;
+    uint8  index = HrhObj->HRHIndex ;
+    uint32 BaseAddress = Global_Config->CanHardwareObjectRef[index].CanControllerRef->CanControllerBaseAddress ;
+    uint32 IfBase = BaseAddress + IfOffset ;
+    uint8  Cursor = HrhObj->NextObject ;
+    uint8  HW_Obj_Index = 0 ;
+    uint32 Processed = 0 ;
+    uint8  FramesRead = 0 ;
+    uint32 NewData = 0 ;
+    uint32 EobRead = 0 ;
+    uint16 EobCtrl = 0 ;
+    uint16 ui16ArbReg_2 = 0 ;
+    Can_IdType RxCanId = 0 ;
+    uint8  RxLength = 0 ;
 
-                if (Global_Config->CanHardwareObjectRef[hth_index].CanIdType == EXTENDED)
+    /*
+     * Message Control register of each object read, written back without NEWDAT
+     */
+    uint16 MsgCtrl[CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS] ;
+
+    /*
+     * Frames read and not given to the upper layer yet, a frame is written in place in the
+     * ring buffer when it is deferred
+     */
+    str_RxFrame LocalFrame[CAN_RX_INDICATION_FRAMES] ;
+    uint8 LocalCount = 0 ;
+    str_RxFrame * Frame = NULL_PTR ;
+    boolean FrameKept = FALSE ;
+
+    while (0 != (NewData = (HWREG(BaseAddress + CAN_O_NWDA1) | (HWREG(BaseAddress + CAN_O_NWDA2) << 16)) &
+                           HrhObj->PoolMask & ~Processed))
+    {
+        /* The oldest frame is in the first new object from the cursor, else from the bottom */
+        if (0 != (NewData & ~(((uint32)1 << Cursor) - 1)))
+        {
+            NewData &= ~(((uint32)1 << Cursor) - 1) ;
+        }
+        HW_Obj_Index = (uint8)__CLZ(__RBIT(NewData)) ;
+
+        /* Read the object and clear INTPND, NEWDAT is kept so the object is not reused */
+        while(HWREG(IfBase + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+        {
+        }
+        HWREG(IfBase + CAN_O_IF1CMSK) = HrhObj->ReadCmsk ;
+        HWREG(IfBase + CAN_O_IF1CRQ) = HW_Obj_Index + 1 ;
+        while(HWREG(IfBase + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+        {
+        }
+        MsgCtrl[HW_Obj_Index] = HWREG(IfBase + CAN_O_IF1MCTL) ;
+
+        /* A frame was overwritten since this object was last released */
+        if (MsgCtrl[HW_Obj_Index] & CAN_IF1MCTL_MSGLST)
+        {
+            RxFifoLostCount[Hrh_count]++ ;
+        }
+
+        if (0 == (HrhObj->ReadCmsk & CAN_IF1CMSK_ARB))
+        {
+            /* The filter of the HRH only lets its 11-bit code through */
+            ui16ArbReg_2 = 0 ;
+            RxCanId = HrhObj->FixedCanId ;
+        }
+        else
+        {
+            ui16ArbReg_2 = HWREG(IfBase + CAN_O_IF1ARB2) ;
+            if (ui16ArbReg_2 & CAN_IF1ARB2_XTD)
+            {
+                RxCanId = HWREG(IfBase + CAN_O_IF1ARB1) | ((ui16ArbReg_2 & CAN_IF1ARB2_ID_M) << 16) ;
+            }
+            else
+            {
+                RxCanId = (ui16ArbReg_2 & CAN_IF1ARB2_ID_STAND) >> 2 ;
+            }
+        }
+
+        /* The DLC codes 9 to 15 stand for 8 data bytes */
+        RxLength = MsgCtrl[HW_Obj_Index] & CAN_IF1MCTL_DLC_M ;
+        if (RxLength > MAX_DATA_LENGTH)
+        {
+            RxLength = MAX_DATA_LENGTH ;
+        }
+
+        FrameKept = FALSE ;
+        if (RxLength > HrhObj->MaxDlc)
+        {
+            /* Only the data bytes up to the largest DLC of the HRH were read, the frame
+             * is not given cut to the upper layer */
+            RxDlcLostCount[Hrh_count]++ ;
+        }
+        else
+#if(CanSwAcceptanceFilter == STD_ON)
+        /* A frame the application does not want is dropped before its data is copied */
+        if (TRUE == SwFilterAccept(Global_Config->CanHardwareObjectRef[index].CanSwFilterRef,
+                                   RxCanId, (ui16ArbReg_2 & CAN_IF1ARB2_XTD)))
+#endif
+        {
+            Frame = &LocalFrame[LocalCount] ;
+            FrameKept = TRUE ;
+#if(CanRxDeferredProcessing == STD_ON)
+            if (CAN_IF_ISR == IfOffset)
+            {
+                if ((uint8)(RxRing.Head - RxRing.Tail) < CAN_RX_RING_SIZE)
                 {
-                    ui16ArbReg_1 |= PduInfo->id & CAN_IF1ARB1_ID_M ;
-                    ui16ArbReg_2 |= (PduInfo->id >> 16 ) & CAN_IF1ARB2_ID_M ;
-                    ui16ArbReg_2 |= CAN_IF1ARB2_MSGVAL | CAN_IF1ARB2_XTD ;
+                    Frame = &RxRing.Frame[RxRing.Head & (CAN_RX_RING_SIZE - 1)] ;
                 }
-                else if (Global_Config->CanHardwareObjectRef[hth_index].CanIdType == STANDARD)
+                else
                 {
-                    ui16ArbReg_1 &=~ CAN_IF1ARB2_MSGVAL ;
-                    ui16ArbReg_2 |= (  PduInfo->id  << 2 ) & CAN_IF1ARB2_ID_STAND ;
-
+                    /* The ring buffer is full, the frame is lost */
+                    RxRingLostCount++ ;
+                    FrameKept = FALSE ;
                 }
-                else
+            }
+#endif
+#if(CanRxBufferLoan == STD_ON)
+            /* The data is read straight into the buffer lent to the upper layer */
+            if (TRUE == FrameKept)
+            {
+                Frame->sdu = TakeRxBuffer() ;
+                if (NULL_PTR == Frame->sdu)
                 {
+                    RxBufferLostCount++ ;
+                    FrameKept = FALSE ;
                 }
-                ui16MsgCtrl |=  ( ( PduInfo->length ) & CAN_IF1MCTL_DLC_M ) ;
-                ui16MsgCtrl |= CAN_IF1MCTL_EOB  | CAN_IF1MCTL_TXRQST ;
-
-                CANDataRegWrite (
-                        PduInfo->sdu,
-                        (uint32 *)( ui32Base + CAN_O_IF1DA1 ),
-                        PduInfo->length
-                );
-
-                HWREG(ui32Base + CAN_O_IF1CMSK) = ui16CmdMaskReg;
-                HWREG(ui32Base + CAN_O_IF1MSK1) = ui16MaskReg_1;
-                HWREG(ui32Base + CAN_O_IF1MSK2) = ui16MaskReg_2;
-                HWREG(ui32Base + CAN_O_IF1ARB1) = ui16ArbReg_1;
-                HWREG(ui32Base + CAN_O_IF1ARB2) = ui16ArbReg_2;
-                HWREG(ui32Base + CAN_O_IF1ARB2) |= CAN_IF1ARB2_MSGVAL;
-                HWREG(ui32Base + CAN_O_IF1MCTL) |= ui16MsgCtrl;
-
-               for (Hth_count = 0 ; Hth_count < CAN_HTH_NUMBER  ; Hth_count++)
+            }
+#endif
+        }
+
+        if (TRUE == FrameKept)
+        {
+            Frame->CanId = RxCanId ;
+            Frame->Hoh = Global_Config->CanHardwareObjectRef[index].CanObjectId ;
+            Frame->ControllerId = Global_Config->CanHardwareObjectRef[index].CanControllerRef->CanControllerId ;
+            Frame->length = RxLength ;
+            Frame->TimeStamp = TimeStamp ;
+            CANDataRegGet(Frame->sdu, (uint32 *)(IfBase + CAN_O_IF1DA1), Frame->length) ;
+
+#if(CanRxDeferredProcessing == STD_ON)
+            if (CAN_IF_ISR == IfOffset)
+            {
+                /* The frame is complete before the consumer can see it */
+                __DMB() ;
+                RxRing.Head++ ;
+            }
+            else
+#endif
+            {
+                /* The frames are given to the upper layer once the batch is full */
+                LocalCount++ ;
+                if (CAN_RX_INDICATION_FRAMES == LocalCount)
                 {
-                    uint8 index = MessageObjAssignedToHTH[Hth_count].HTHIndex ;
-                    if (Hth ==  Global_Config->CanHardwareObjectRef[index].CanObjectId)
-                    {
-                        real_hwObjectId = MessageObjAssignedToHTH[Hth_count].MessageId ;
-                        MessageObjAssignedToHTH[Hth_count].Tx_Request = TRUE ;
-                        break ;
-                    }
+                    IndicateRxFrames(LocalFrame, LocalCount) ;
+                    LocalCount = 0 ;
                 }
+            }
+        }
 
-                HWREG(ui32Base + CAN_O_IF1CRQ) = real_hwObjectId ;
-                HTH_Semaphore[hth_index] = 0 ;
+        Processed |= (uint32)1 << HW_Obj_Index ;
+        FramesRead++ ;
+        Cursor = HW_Obj_Index + 1 ;
+        if (Cursor >= HrhObj->EndMessageId)
+        {
+            Cursor = HrhObj->StartMessageId - 1 ;
+        }
+    }
+    HrhObj->NextObject = Cursor ;
 
-                /*
-                 *  [SWS_Can_00276] ⌈ The function Can_Write shall store the swPduHandle that is
-                    given inside the parameter PduInfo until the Can module calls the
-                    CanIf_TxConfirmation for this request where the swPduHandle is given as
-                    parameter.()
-                 */
-                swPduHandle[Hth_count] = PduInfo->swPduHandle ;
+    if (0 != LocalCount)
+    {
+        IndicateRxFrames(LocalFrame, LocalCount) ;
+    }
 
-                    /*
-                     * (SRS_Can_01049)
-                     */
-                returnVal = E_OK ;
-            }
+    /* The last object of the FIFO is overwritten when the FIFO is full, it is released last */
+    EobRead = Processed & ((uint32)1 << (HrhObj->EndMessageId - 1)) ;
+    Processed &= ~EobRead ;
+
+    /* Release the objects read, clearing NEWDAT and MSGLST */
+    while (0 != Processed)
+    {
+        HW_Obj_Index = (uint8)__CLZ(__RBIT(Processed)) ;
+        Processed &= (Processed - 1) ;
+
+        while(HWREG(IfBase + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+        {
         }
-        else
+        HWREG(IfBase + CAN_O_IF1CMSK) = CAN_IF1CMSK_WRNRD | CAN_IF1CMSK_CONTROL ;
+        HWREG(IfBase + CAN_O_IF1MCTL) = MsgCtrl[HW_Obj_Index] &
+                                        ~(CAN_IF1MCTL_NEWDAT | CAN_IF1MCTL_MSGLST | CAN_IF1MCTL_INTPND) ;
+        HWREG(IfBase + CAN_O_IF1CRQ) = HW_Obj_Index + 1 ;
+    }
+
+    if (0 != EobRead)
+    {
+        /*
+         * A frame received since the last object was read overwrote it and sets MSGLST.
+         * NEWDAT is cleared by the read transfer itself, so no frame arriving from now on
+         * is cleared unseen, and it goes to the objects released above.
+         */
+        HW_Obj_Index = HrhObj->EndMessageId - 1 ;
+        while(HWREG(IfBase + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
         {
-               /*MISRA Rule*/
         }
+        HWREG(IfBase + CAN_O_IF1CMSK) = CAN_IF1CMSK_CONTROL | CAN_IF1CMSK_NEWDAT | CAN_IF1CMSK_CLRINTPND ;
+        HWREG(IfBase + CAN_O_IF1CRQ) = HW_Obj_Index + 1 ;
+        while(HWREG(IfBase + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+        {
+        }
+        EobCtrl = HWREG(IfBase + CAN_O_IF1MCTL) ;
 
+        if (EobCtrl & CAN_IF1MCTL_MSGLST)
+        {
+            /* An overrun already seen when the object was read is counted once */
+            if (0 == (MsgCtrl[HW_Obj_Index] & CAN_IF1MCTL_MSGLST))
+            {
+                RxFifoLostCount[Hrh_count]++ ;
+            }
+            HWREG(IfBase + CAN_O_IF1CMSK) = CAN_IF1CMSK_WRNRD | CAN_IF1CMSK_CONTROL ;
+            HWREG(IfBase + CAN_O_IF1MCTL) = EobCtrl &
+                                            ~(CAN_IF1MCTL_NEWDAT | CAN_IF1MCTL_MSGLST | CAN_IF1MCTL_INTPND) ;
+            HWREG(IfBase + CAN_O_IF1CRQ) = HW_Obj_Index + 1 ;
+        }
+    }
+    while(HWREG(IfBase + CAN_O_IF1CRQ) & CAN_IF1CRQ_BUSY)
+    {
+    }
 
-    return returnVal ;
+    return FramesRead ;
 }
 
-static void CANDataRegWrite ( uint8 * pui8Data, uint32 * pui32Register , uint8 ui8Size)
+#if(CanRxDeferredProcessing == STD_ON)
+/************************************************************************************
+* Function Name: RxRingDrain
+* Parameters (in): None
+* Return value: None
+* Description: Gives the frames queued in the ring buffer by Serve_Interrupts to CanIf,
+*              in the order of their reception. Only called by the consumer of the ring,
+*              Can_MainFunction_Read or PendSV_Handler.
+************************************************************************************/
+static void RxRingDrain(void)
 {
-
-    uint8 index ;
-    uint16 ui16DataValue ;
-
-
-    for (index = 0 ; index < ui8Size;)
+    while(RxRing.Tail != RxRing.Head)
     {
+        uint8 Slot = RxRing.Tail & (CAN_RX_RING_SIZE - 1);
+        uint8 Count = (uint8)(RxRing.Head - RxRing.Tail);
 
-        ui16DataValue = pui8Data[index++] ;
+        /* The frames are read after the index written by the producer */
+        __DMB();
 
-        if (index < ui8Size)
+        /* The frames given together are contiguous, a batch stops at the end of the ring */
+        if(Count > (CAN_RX_RING_SIZE - Slot))
+        {
+            Count = CAN_RX_RING_SIZE - Slot;
+        }
+        if(Count > CAN_RX_INDICATION_FRAMES)
         {
-            ui16DataValue |= ( pui8Data[index++] << 8 ) ;
+            Count = CAN_RX_INDICATION_FRAMES;
         }
+        IndicateRxFrames(&RxRing.Frame[Slot], Count);
+
+        /* The slots are given back once CanIf has copied the data, or kept the lent buffers */
+        __DMB();
+        RxRing.Tail += Count;
+    }
+}
+#endif
 
+/************************************************************************************
+* Function Name: IndicateRxFrames
+* Parameters (in): Frame  :  frames to give to the upper layer, in their order of arrival
+*                  Count  :  number of frames, up to CAN_RX_INDICATION_FRAMES
+* Return value: None
+* Description: Gives received frames to CanIf, all together with CanIf_RxIndicationBatch
+*              when CanRxIndicationBatch is on, else with one CanIf_RxIndication each.
+************************************************************************************/
+static void IndicateRxFrames(const str_RxFrame Frame[], uint8 Count)
+{
+    uint8 index = 0 ;
+#if(CanRxIndicationBatch == STD_ON)
+    Can_RxFrame Batch[CAN_RX_INDICATION_FRAMES] ;
 
-        HWREG(pui32Register++) = ui16DataValue;
+    for (index = 0 ; index < Count ; index++)
+    {
+        Batch[index].Mailbox.CanId = Frame[index].CanId ;
+        Batch[index].Mailbox.Hoh = Frame[index].Hoh ;
+        Batch[index].Mailbox.ControllerId = Frame[index].ControllerId ;
+        Batch[index].PduInfo.SduLength = Frame[index].length ;
+        Batch[index].PduInfo.SduDataPtr = (uint8 *)Frame[index].sdu ;
+        Batch[index].PduInfo.MetaDataPtr = NULL_PTR ;
+        Batch[index].TimeStamp = Frame[index].TimeStamp ;
+    }
+    CanIf_RxIndicationBatch(Batch, Count) ;
+#else
+    Can_HwType Mailbox ;
+    PduInfoType PduInfo ;
 
+    for (index = 0 ; index < Count ; index++)
+    {
+        Mailbox.CanId = Frame[index].CanId ;
+        Mailbox.Hoh = Frame[index].Hoh ;
+        Mailbox.ControllerId = Frame[index].ControllerId ;
+        PduInfo.SduLength = Frame[index].length ;
+        PduInfo.SduDataPtr = (uint8 *)Frame[index].sdu ;
+        CAN_RX_INDICATION(&Mailbox, &PduInfo, Frame[index].TimeStamp) ;
     }
+#endif
+}
+
+#if(CanSwAcceptanceFilter == STD_ON)
+/************************************************************************************
+* Function Name: SwFilterAccept
+* Parameters (in): Filter    :  software acceptance filter of the HRH, may be NULL_PTR
+*                  CanId     :  identifier of the received frame
+*                  Extended  :  not 0 for a 29-bit identifier
+* Return value: TRUE when the frame is given to the upper layers
+* Description: An 11-bit identifier is checked with one bit of the accept bitmap, a
+*              29-bit identifier with a binary search of the sorted accepted identifiers,
+*              so the cost per frame is bounded by the size of the configured tables.
+************************************************************************************/
+static boolean SwFilterAccept(const CanSwFilter * Filter, Can_IdType CanId, uint16 Extended)
+{
+    boolean Accepted = TRUE ;
+    uint16 Low = 0 ;
+    uint16 High = 0 ;
+    uint16 Middle = 0 ;
 
+    if (NULL_PTR == Filter)
+    {
+        /* No software filter for this HRH */
+    }
+    else if (0 == Extended)
+    {
+        if (NULL_PTR != Filter->CanSwFilterStdBitmap)
+        {
+            Accepted = (boolean)((Filter->CanSwFilterStdBitmap[(CanId & 0x7FF) >> 5] >> (CanId & 31)) & 1) ;
+        }
+    }
+    else if (NULL_PTR != Filter->CanSwFilterExtIds)
+    {
+        Accepted = FALSE ;
+        High = Filter->CanSwFilterExtIdCount ;
+        while (Low < High)
+        {
+            Middle = (uint16)((Low + High) >> 1) ;
+            if (Filter->CanSwFilterExtIds[Middle] < CanId)
+            {
+                Low = Middle + 1 ;
+            }
+            else
+            {
+                High = Middle ;
+            }
+        }
+        if ((Low < Filter->CanSwFilterExtIdCount) && (Filter->CanSwFilterExtIds[Low] == CanId))
+        {
+            Accepted = TRUE ;
+        }
+    }
+    else
+    {
+        /* All 29-bit identifiers are accepted */
+    }
 
+    return Accepted ;
 }
+#endif
 
 /*---------------------------------------------------------------------
  Function Name:  <Can_MainFunction_Mode>
@@ -1620,9 +3356,15 @@ void Can_MainFunction_Write(void)
 {
 	uint8  counter= 0;
 	uint8  index = 0;
+	uint8  controllerId = 0;
+	uint8  HW_Obj_Index = 0;
 	uint32 BaseAddress = 0 ;
 	uint32 Read_TXRQ_register = 0 ;
+	uint32 Completed_Objects  = 0 ;
 	uint8  Read_STS_register  = 0 ;
+#if(CanTimeStampEnable == STD_ON)
+	uint64 TimeStamp = 0 ;
+#endif
 
     /*
     * Search only in the Transmit objects array
@@ -1638,152 +3380,457 @@ void Can_MainFunction_Write(void)
         {
             /**Save Message controller BaseAddress */
             BaseAddress = Global_Config->CanHardwareObjectRef[index].CanControllerRef->CanControllerBaseAddress ;
-            /*Check if the message had a transmit request */
-            if(MessageObjAssignedToHTH[counter].Tx_Request == TRUE)
+            controllerId = Global_Config->CanHardwareObjectRef[index].CanControllerRef->CanControllerId ;
+            /*Check if any message object of the pool had a transmit request, the requests
+             * are read before CANTXRQ1/2 since a request is only set once its TXRQST bit is */
+            Completed_Objects = MessageObjAssignedToHTH[counter].Tx_Request ;
+            if(Completed_Objects != 0)
             {
 
                 /*The CANTXRQ1 and CANTXRQ2 registers hold the TXRQST bits of the 32 message objects.
                  *  By reading out these bits,the CPU can check which message object
-                 *  has a transmission request pending.*/
+                 *  has a transmission request pending.
+                 *  The CANTXRQ1 holds the first 16 messages and CANTXRQ2 holds the last 16 messages*/
+                Read_TXRQ_register = HWREG(BaseAddress + CAN_O_TXRQ1) | (HWREG(BaseAddress + CAN_O_TXRQ2) << 16) ;
+#if(CanTimeStampEnable == STD_ON)
+                CAN_GET_TIMESTAMP(TimeStamp) ;
+#endif
 
-                /*The CANTXRQ1 holds the first 16 messages*/
-                if(MessageObjAssignedToHTH[counter].MessageId<= 16 )
-                {
-                    Read_TXRQ_register = HWREG(BaseAddress + CAN_O_TXRQ1) ;
-                }
-                /*The CANTXRQ2 holds the last 16 messages*/
-                else if(MessageObjAssignedToHTH[counter].MessageId<=32)
-                {
-                    Read_TXRQ_register = HWREG(BaseAddress + CAN_O_TXRQ2)<<16 ;
-                }
-                else
-                {
-                    /**MISRA Rule**/
-                }
                 /*Read Status register to check TXOK transmitted message successfully*/
                 Read_STS_register = HWREG(BaseAddress + CAN_O_STS) & CAN_STS_TXOK;
 
-                /*If TXOK and message request has been cleared and Call Tx_Confirmation*/
-                if(!(Read_TXRQ_register &(1<<(MessageObjAssignedToHTH[counter].MessageId-1))))
+                /*Requested message objects whose request has been cleared by the hardware */
+                Completed_Objects &= ~Read_TXRQ_register ;
+
+                /*Reset TXOK bit*/
+                if(Read_STS_register && Completed_Objects)
                 {
-                    /*Reset Tx_Request flag*/
-                    MessageObjAssignedToHTH[counter].Tx_Request = FALSE ;
-                    /*Reset TXOK bit*/
-                    if(Read_STS_register)
-                    {
                     HWREG(BaseAddress + CAN_O_STS) &= ~CAN_STS_TXOK ;
+                }
+
+                while(Completed_Objects != 0)
+                {
+                    HW_Obj_Index = (uint8)__CLZ(__RBIT(Completed_Objects));
+                    Completed_Objects &= (Completed_Objects - 1);
+
+                    /*Reset Tx_Request flag, Can_write may set other bits from another context
+                     * and a cancelled request was already reported by Can_write */
+                    if(AtomicClearBits(&MessageObjAssignedToHTH[counter].Tx_Request, (uint32)1 << HW_Obj_Index) &
+                       ((uint32)1 << HW_Obj_Index))
+                    {
+                        /*Call Tx_Confirmation indication for successful transmission */
+                        CAN_TX_CONFIRMATION(swPduHandle[controllerId][HW_Obj_Index], TimeStamp);
+                        ReleaseTxMessageObject(counter, HW_Obj_Index);
                     }
-                    /*Call Tx_Confirmation indication for successful transmission */
-                    CanIf_TxConfirmation(swPduHandle[counter]);
                 }
             }
         }
+
+        controllerId = MessageObjAssignedToHTH[counter].ControllerId ;
+#if(CanHardwareCancellation == STD_ON)
+        /*Confirm or report cancelled the L-PDUs whose cancellation is finished, when a
+         * preempted task owns the IF1 registers it is done by the next call */
+        if ((0 != MessageObjAssignedToHTH[counter].Tx_Cancel) && (TRUE == AcquireTaskIf(controllerId)))
+        {
+            ResolveTxCancellations(counter);
+            ReleaseTaskIf(controllerId);
+        }
+#endif
+
+        /*Move the queued L-PDUs into the message objects freed in the meantime */
+        if ((0 != TxQueue[counter].Count) && (TRUE == AcquireTaskIf(controllerId)))
+        {
+            TxQueueDrain(counter, CAN_IF_TASK);
+            ReleaseTaskIf(controllerId);
+        }
     }
 }
 #endif
 
 
 
-#if( CanTxProcessing == MIXED_PROCESSING || CanTxProcessing == INTERRUPT_PROCESSING ||\
-     CanRxProcessing == MIXED_PROCESSING || CanRxProcessing == INTERRUPT_PROCESSING )
-static void Serve_Interrupts(uint32 BaseAddress)
+#if(CAN_INTERRUPTS_USED == STD_ON)
+/************************************************************************************
+* Function Name: Serve_Interrupts
+* Parameters (in): ControllerId  :  controller to serve
+*                  BaseAddress   :  base address of its registers
+*                  Budget        :  number of frames after which it returns, the pending
+*                                   events left are served by the next call
+* Return value: number of frames received
+* Description: Serves the pending events given by CANINT through the IF2 registers, from
+*              the CAN interrupt or from the polling tick at the same priority. With
+*              CanInterruptBottomHalf the events are only latched for PendSV_Handler.
+************************************************************************************/
+static uint16 Serve_Interrupts(uint8 ControllerId, uint32 BaseAddress, uint16 Budget)
 {
+    uint16 Frames = 0;
     uint8 count = 0;
-    uint8 index = 0;
-    uint32 Read_INTPND_Register = 0 ;
-
+    uint8 HW_Obj_Index = 0;
+    uint32 Read_INT_Register = 0 ;
+#if(CanBusoffProcessing == INTERRUPT)
+    uint32 Read_STS_Register = 0 ;
+#endif
+    uint64 RxTimeStamp = 0 ;
+#if(CanInterruptBottomHalf == STD_ON)
+    boolean Latched = FALSE ;
+#endif
 
-    Read_INTPND_Register = HWREG(BaseAddress + CAN_O_MSG1INT ) & CAN_MSG1INT_INTPND_M;
-    Read_INTPND_Register |=((HWREG(BaseAddress + CAN_O_MSG2INT )&CAN_MSG1INT_INTPND_M)<<16) ;
+    /* The frames received are stamped with the entry in the interrupt */
+    CAN_GET_TIMESTAMP(RxTimeStamp) ;
 
-    for(count=0 ;count< CAN_HTH_NUMBER ;count++ )
+    /*
+     * The CANINT register gives the pending interrupt with the highest priority: the status
+     * interrupt, then the message object with the lowest number. The owner of the message
+     * object is found in the lookup table built by Can_Init, so the cost only depends on
+     * the number of pending interrupts. CANINT reads zero once all of them are served
+     */
+    while((Frames < Budget) &&
+          (CAN_INT_INTID_NONE != (Read_INT_Register = (HWREG(BaseAddress + CAN_O_INT) & CAN_INT_INTID_M))))
     {
-        index = MessageObjAssignedToHTH[count].HTHIndex ;
-        if(Global_Config->CanHardwareObjectRef[index].CanHardwareObjectUsesPolling == FALSE)
+        /* Index of the pending message object (message object number - 1) */
+        HW_Obj_Index = (uint8)((Read_INT_Register - 1) & (CAN_CONTROLLER_ALLOWED_MESSAGE_OBJECTS - 1));
+
+        count = MessageObjMap[ControllerId][HW_Obj_Index].Index;
+
+        if(CAN_INT_INTID_STATUS == Read_INT_Register)
+        {
+            /* Reading the status register clears the status interrupt */
+#if(CanBusoffProcessing == INTERRUPT)
+            Read_STS_Register = HWREG(BaseAddress + CAN_O_STS) ;
+            /*
+             * The error warning and error passive levels are read back by
+             * Can_GetControllerErrorState, only the bus-off is notified. LEC is set to
+             * "no event" so the next error code read is a new one
+             */
+            HWREG(BaseAddress + CAN_O_STS) = (Read_STS_Register & (CAN_STS_TXOK | CAN_STS_RXOK)) |
+                                             CAN_STS_LEC_NOEVENT ;
+            if((Read_STS_Register & CAN_STS_BOFF) && (CAN_CS_STARTED == ControllerState[ControllerId]))
+            {
+                /* [SWS_Can_00020] the controller left the bus, it already set its INIT bit */
+                ControllerState[ControllerId] = CAN_CS_STOPPED ;
+#if(CanInterruptBottomHalf == STD_ON)
+                (void)AtomicSetBits(&BusOffPending, (uint32)1 << ControllerId) ;
+                Latched = TRUE ;
+#else
+                CanIf_ControllerBusOff(ControllerId) ;
+#endif
+            }
+#else
+            (void)HWREG(BaseAddress + CAN_O_STS) ;
+#endif
+        }
+        else if(MessageObjMap[ControllerId][HW_Obj_Index].ObjectType == TRANSMIT)
         {
-            if(Read_INTPND_Register &(1<<(MessageObjAssignedToHTH[count].MessageId-1)))
+            /* The message objects of the polled HTHs only interrupt while their request
+             * is cancelled. The interrupt only uses the IF2 registers, the IF1 registers
+             * may be in the middle of a transfer started by the preempted task */
+            while(HWREG(BaseAddress + CAN_O_IF2CRQ) & CAN_IF2CRQ_BUSY)
+            {
+            }
+            HWREG(BaseAddress + CAN_O_IF2CMSK) = CAN_IF2CMSK_CLRINTPND ;
+            HWREG(BaseAddress + CAN_O_IF2MCTL) &= ~ CAN_IF2MCTL_INTPND ;
+            HWREG(BaseAddress + CAN_O_IF2CRQ)   = HW_Obj_Index + 1 ;
+            HWREG(BaseAddress + CAN_O_STS) &=~CAN_STS_TXOK ;
+            /* CANINT is read again once INTPND is cleared */
+            while(HWREG(BaseAddress + CAN_O_IF2CRQ) & CAN_IF2CRQ_BUSY)
+            {
+            }
+            /*Reset Tx_Request flag of this message object of the pool, a cancelled
+             * request is found in Tx_Cancel */
+            if(AtomicClearBits(&MessageObjAssignedToHTH[count].Tx_Request, (uint32)1 << HW_Obj_Index) &
+               ((uint32)1 << HW_Obj_Index))
+            {
+                /* The object stays claimed until the confirmation, so its swPduHandle is kept */
+                ConfirmTxMessageObject(count, HW_Obj_Index);
+            }
+#if(CanHardwareCancellation == STD_ON)
+            else if(AtomicClearBits(&MessageObjAssignedToHTH[count].Tx_Cancel, (uint32)1 << HW_Obj_Index) &
+                    ((uint32)1 << HW_Obj_Index))
+            {
+                /* Sent before its request could be cleared */
+                ConfirmTxMessageObject(count, HW_Obj_Index);
+            }
+#endif
+            else if(MessageObjAssignedToHTH[count].Tx_Claimed & ((uint32)1 << HW_Obj_Index))
+            {
+                /* Sent before the task that wrote it set its Tx_Request bit, the task
+                 * confirms it once it did */
+                (void)AtomicSetBits(&MessageObjAssignedToHTH[count].Tx_Sent, (uint32)1 << HW_Obj_Index) ;
+            }
+#if(CanInterruptBottomHalf == STD_OFF)
+            /*The freed message object takes the queued L-PDU with the lowest ID */
+            TxQueueDrain(count, CAN_IF_ISR);
+#endif
+        }
+        else if((MessageObjMap[ControllerId][HW_Obj_Index].ObjectType == RECEIVE) &&
+                (Global_Config->CanHardwareObjectRef[MessageObjAssignedToHRH[count].HRHIndex].CanHardwareObjectUsesPolling == FALSE))
+        {
+            /* All the frames of the FIFO are read in their order of arrival, whichever
+             * of its objects CANINT gave */
+            Frames += ReadRxFifo(count, CAN_IF_ISR, RxTimeStamp);
+            HWREG(BaseAddress + CAN_O_STS) &=~CAN_STS_RXOK;
+#if(CanInterruptBottomHalf == STD_ON)
+            /* The frames wait in the ring buffer */
+            Latched = TRUE ;
+#endif
+        }
+        else
+        {
+            /* A message object not served by this interrupt, its INTPND is cleared so that
+             * CANINT moves on to the next pending interrupt */
+            while(HWREG(BaseAddress + CAN_O_IF2CRQ) & CAN_IF2CRQ_BUSY)
+            {
+            }
+            HWREG(BaseAddress + CAN_O_IF2CMSK) = CAN_IF2CMSK_CLRINTPND ;
+            HWREG(BaseAddress + CAN_O_IF2CRQ)   = HW_Obj_Index + 1 ;
+            while(HWREG(BaseAddress + CAN_O_IF2CRQ) & CAN_IF2CRQ_BUSY)
             {
-                HWREG(BaseAddress + CAN_O_IF1CMSK) = CAN_IF1CMSK_CLRINTPND ;
-                HWREG(BaseAddress + CAN_O_IF1MCTL) &= ~ CAN_IF1MCTL_INTPND ;
-                HWREG(BaseAddress + CAN_O_IF1CRQ)   = MessageObjAssignedToHTH[count].MessageId ;
-                HWREG(BaseAddress + CAN_O_STS) &=~CAN_STS_TXOK ;
-                /*Reset Tx_Request flag*/
-                MessageObjAssignedToHTH[count].Tx_Request = FALSE ;
-                CanIf_TxConfirmation(swPduHandle[count]);
             }
-
         }
     }
-    for(count=0 ;count< CAN_HRH_NUMBER ;count++ )
+
+#if(CanInterruptBottomHalf == STD_ON)
+    if(TRUE == Latched)
+    {
+        CAN_PEND_BOTTOM_HALF() ;
+    }
+#endif
+
+    return Frames;
+}
+
+#endif
+
+#if(CanRxAdaptivePolling == STD_ON)
+/************************************************************************************
+* Function Name: RxNapiInterrupt
+* Parameters (in): ControllerId  :  controller whose interrupt is served
+*                  BaseAddress   :  base address of its registers
+* Return value: None
+* Description: Serves the CAN interrupt of a controller and counts the frames received
+*              in the current window. Above CAN_RX_NAPI_THRESHOLD the interrupts of the
+*              controller are switched off and the Timer0A tick polls it. CAN_CTL_IE is
+*              used as the RXIE bits can only be changed by a read-modify-write of the
+*              control bits of each message object, losing a NEWDAT set meanwhile.
+************************************************************************************/
+static void RxNapiInterrupt(uint8 ControllerId, uint32 BaseAddress)
+{
+    str_RxNapi * Napi = &RxNapi[ControllerId] ;
+    uint64 Now = 0 ;
+
+    /* An interrupt pending when the polling started, the tick serves the events */
+    if (TRUE == Napi->Polling)
+    {
+        return ;
+    }
+
+    syst_GetTimeStampCycles(&Now) ;
+    if ((Now - Napi->WindowStart) > CAN_RX_NAPI_WINDOW_CYCLES)
+    {
+        Napi->WindowStart = Now ;
+        Napi->WindowFrames = 0 ;
+    }
+    Napi->WindowFrames += Serve_Interrupts(ControllerId, BaseAddress, CAN_RX_NAPI_BUDGET) ;
+
+    if (Napi->WindowFrames > CAN_RX_NAPI_THRESHOLD)
+    {
+        HWREG(BaseAddress + CAN_O_CTL) &= ~CAN_CTL_IE ;
+        Napi->Polling = TRUE ;
+        Napi->Counters.ToPolling++ ;
+        Timer0A_Arm() ;
+    }
+}
+
+/************************************************************************************
+* Service Name: Can_RxPollTick
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Polling tick of the adaptive receive mode, called by Timer0A_Handler at
+*              CAN_IRQ_PRIORITY. Each polled controller is served up to CAN_RX_NAPI_BUDGET
+*              frames, once it has no event pending its interrupts are switched on again.
+*              The tick is disarmed when no controller is polled anymore.
+************************************************************************************/
+void Can_RxPollTick ( void )
+{
+    uint8 ControllerId = 0 ;
+    uint32 BaseAddress = 0 ;
+    boolean StillPolling = FALSE ;
+
+    for (ControllerId = 0 ; ControllerId < USED_CONTROLLERS_NUMBER ; ControllerId++)
     {
-        index = MessageObjAssignedToHRH[count].HRHIndex ;
-        if(Global_Config->CanHardwareObjectRef[index].CanHardwareObjectUsesPolling == FALSE)
+        if (TRUE == RxNapi[ControllerId].Polling)
         {
-            for(uint8 HW_Obj_Index = MessageObjAssignedToHRH[count].StartMessageId;
-                      HW_Obj_Index <= MessageObjAssignedToHRH[count].EndMessageId ; HW_Obj_Index++)
+            /* Controller interrupts disabled by the upper layer are not served meanwhile */
+            if (0 == DisableCnt[ControllerId])
             {
-                if(Read_INTPND_Register &(1<<(HW_Obj_Index-1)))
-                {
-                    HWREG(BaseAddress + CAN_O_IF2CMSK) = (CAN_IF2CMSK_DATAA | CAN_IF1CMSK_DATAB |\
-                                                          CAN_IF2CMSK_CONTROL | CAN_IF1CMSK_MASK|\
-                                                          CAN_IF2CMSK_ARB);
-                    HWREG(BaseAddress + CAN_O_IF2CRQ)   =  HW_Obj_Index ;
-                    // mailbox for Callback function RxIndication
-                    Can_HwType Mailbox;
-                    PduInfoType PduInfo;
-                    uint8 Data[MAX_DATA_LENGTH];
-
-                    //message ID
-                    if(Global_Config->CanHardwareObjectRef[index].CanIdType == STANDARD)
-                    {
-                        Mailbox.CanId = (HWREG(BaseAddress + CAN_O_IF2ARB2) & CAN_IF2ARB2_ID_STANDARD) >>2 ;
-                    }
-                    else
-                    {
-                        Mailbox.CanId = HWREG(BaseAddress + CAN_O_IF2ARB1) |
-                                        ((HWREG(BaseAddress + CAN_O_IF2ARB2) & CAN_IF2ARB2_ID_M)<<16) ;
-                    }
-                    //hardware object that has new data
-                    Mailbox.Hoh = Global_Config->CanHardwareObjectRef[index].CanObjectId;
-                    // controller ID
-                    Mailbox.ControllerId = Global_Config->CanHardwareObjectRef[index].CanControllerRef->CanControllerId;
-                    //Save data length
-                    PduInfo.SduLength = HWREG(BaseAddress + CAN_O_IF2MCTL) & CAN_IF2MCTL_DLC_M ;
-                    //Save data
-                    _CANDataRegRead( Data ,(uint32*)( BaseAddress+CAN_O_IF2DA1), PduInfo.SduLength) ;
-                    PduInfo.SduDataPtr = Data;
-                    // 2. inform CanIf using API below.
-                    CanIf_RxIndication(&Mailbox, &PduInfo);
-                    HWREG(BaseAddress + CAN_O_IF2MCTL) &= ~ CAN_IF1MCTL_INTPND ;
-                    HWREG(BaseAddress + CAN_O_IF2CMSK) = CAN_IF2CMSK_CLRINTPND ;
-                    HWREG(BaseAddress + CAN_O_STS) &=~CAN_STS_RXOK;
-                    HWREG(BaseAddress + CAN_O_IF2CRQ)   = HW_Obj_Index ;
+                BaseAddress = Global_Config->CanControllerCfgRef[ControllerId].CanControllerBaseAddress ;
+                RxNapi[ControllerId].Counters.PolledFrames +=
+                        Serve_Interrupts(ControllerId, BaseAddress, CAN_RX_NAPI_BUDGET) ;
 
+                if (CAN_INT_INTID_NONE == (HWREG(BaseAddress + CAN_O_INT) & CAN_INT_INTID_M))
+                {
+                    /* The backlog is empty, the next frame raises an interrupt again */
+                    RxNapi[ControllerId].Polling = FALSE ;
+                    RxNapi[ControllerId].WindowFrames = 0 ;
+                    RxNapi[ControllerId].Counters.ToInterrupt++ ;
+                    HWREG(BaseAddress + CAN_O_CTL) |= CAN_CTL_IE ;
                 }
             }
+            StillPolling |= RxNapi[ControllerId].Polling ;
         }
     }
+
+    if (FALSE == StillPolling)
+    {
+        Timer0A_Disarm() ;
+    }
 }
 
+/************************************************************************************
+* Service Name: Can_GetRxModeCounters
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Controller  :  CAN controller
+* Parameters (inout): None
+* Parameters (out): Counters   :  counters of the adaptive receive mode
+* Return value: Std_ReturnType E_NOT_OK if the module or the parameters are not valid
+* Description: Gives the mode switches of the adaptive receive mode of a controller and
+*              the number of frames read by the polling tick.
+************************************************************************************/
+Std_ReturnType Can_GetRxModeCounters ( uint8 Controller, Can_RxModeCountersType * Counters )
+{
+    Std_ReturnType returnVal = E_NOT_OK ;
+
+    if (CAN_UNINIT == ModuleState)
+    {
+        #if (CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_GetRxModeCounters_Id, CAN_E_UNINIT);
+        #endif
+    }
+    else if (Controller >= USED_CONTROLLERS_NUMBER)
+    {
+        #if (CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_GetRxModeCounters_Id, CAN_E_PARAM_CONTROLLER);
+        #endif
+    }
+    else if (NULL_PTR == Counters)
+    {
+        #if (CanDevErrorDetect == STD_ON)
+            Det_ReportError(CAN_MODULE_ID, CAN_INSTANCE_ID, Can_GetRxModeCounters_Id, CAN_E_PARAM_POINTER);
+        #endif
+    }
+    else
+    {
+        /* The counters are updated at the CAN interrupt priority */
+        SchM_Enter_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
+        *Counters = RxNapi[Controller].Counters ;
+        Counters->Polling = RxNapi[Controller].Polling ;
+        SchM_Exit_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS();
+        returnVal = E_OK ;
+    }
+
+    return returnVal ;
+}
 #endif
 
 void CAN0_Handler(void)
 {
-#if( CanTxProcessing == MIXED_PROCESSING || CanTxProcessing == INTERRUPT_PROCESSING ||\
-     CanRxProcessing == MIXED_PROCESSING || CanRxProcessing == INTERRUPT_PROCESSING )
-    Serve_Interrupts(CAN0_BASE_ADDRESS) ;
+#if(CanRxAdaptivePolling == STD_ON)
+    RxNapiInterrupt(CAN0_ID, CAN0_BASE_ADDRESS) ;
+#elif(CAN_INTERRUPTS_USED == STD_ON)
+    (void)Serve_Interrupts(CAN0_ID, CAN0_BASE_ADDRESS, CAN_SERVE_ALL) ;
 #endif
 
 }
 
 void CAN1_Handler(void)
 {
-#if( CanTxProcessing == MIXED_PROCESSING || CanTxProcessing == INTERRUPT_PROCESSING ||\
-     CanRxProcessing == MIXED_PROCESSING || CanRxProcessing == INTERRUPT_PROCESSING )
-    Serve_Interrupts(CAN1_BASE_ADDRESS) ;
+#if(CanRxAdaptivePolling == STD_ON)
+    RxNapiInterrupt(CAN1_ID, CAN1_BASE_ADDRESS) ;
+#elif(CAN_INTERRUPTS_USED == STD_ON)
+    (void)Serve_Interrupts(CAN1_ID, CAN1_BASE_ADDRESS, CAN_SERVE_ALL) ;
 #endif
 }
 
+#if(CanInterruptBottomHalf == STD_ON)
+/************************************************************************************
+* Function Name: PendSV_Handler
+* Parameters (in): None
+* Return value: None
+* Description: Bottom half of the CAN interrupts, at the lowest priority. Notifies CanIf
+*              of the bus-off, the sent L-PDUs and the received frames latched by
+*              Serve_Interrupts, then frees the sent message objects and refills them
+*              from the transmit queues through the IF1 registers, like a task. When a
+*              preempted task owns the IF1 registers it refills them once it is done.
+************************************************************************************/
+void PendSV_Handler(void)
+{
+    uint8 ControllerId = 0 ;
+    uint8 Hth_count = 0 ;
+    uint8 HW_Obj_Index = 0 ;
+    uint32 BusOff = 0 ;
+    uint32 Done = 0 ;
+    uint32 Refill = 0 ;
+#if(CanTimeStampEnable == STD_ON)
+    uint64 TimeStamp = 0 ;
+#endif
+
+    BusOff = AtomicClearBits(&BusOffPending, (uint32)0xFFFFFFFFU) ;
+    for (ControllerId = 0 ; ControllerId < USED_CONTROLLERS_NUMBER ; ControllerId++)
+    {
+        if (0 != (BusOff & ((uint32)1 << ControllerId)))
+        {
+            CanIf_ControllerBusOff(ControllerId) ;
+        }
+    }
+
+    for (Hth_count = 0 ; Hth_count < CAN_HTH_NUMBER ; Hth_count++)
+    {
+        ControllerId = MessageObjAssignedToHTH[Hth_count].ControllerId ;
+        Done = AtomicClearBits(&MessageObjAssignedToHTH[Hth_count].Tx_Done, (uint32)0xFFFFFFFFU) ;
+        if (0 != Done)
+        {
+            Refill |= (uint32)1 << ControllerId ;
+        }
+
+        while (0 != Done)
+        {
+            HW_Obj_Index = (uint8)__CLZ(__RBIT(Done)) ;
+            Done &= (Done - 1) ;
+
+#if(CanTimeStampEnable == STD_ON)
+            TimeStamp = TxDoneTimeStamp[ControllerId][HW_Obj_Index] ;
+#endif
+            CAN_TX_CONFIRMATION(swPduHandle[ControllerId][HW_Obj_Index], TimeStamp) ;
+            ReleaseTxMessageObject(Hth_count, HW_Obj_Index) ;
+        }
+    }
+
+    RxRingDrain() ;
+
+    /* The freed message objects take the queued L-PDUs with the lowest ID */
+    for (ControllerId = 0 ; ControllerId < USED_CONTROLLERS_NUMBER ; ControllerId++)
+    {
+        if ((0 != (Refill & ((uint32)1 << ControllerId))) && (TRUE == AcquireTaskIf(ControllerId)))
+        {
+            for (Hth_count = 0 ; Hth_count < CAN_HTH_NUMBER ; Hth_count++)
+            {
+                if ((MessageObjAssignedToHTH[Hth_count].ControllerId == ControllerId) &&
+                    (0 != TxQueue[Hth_count].Count))
+                {
+                    TxQueueDrain(Hth_count, CAN_IF_TASK) ;
+                }
+            }
+            ReleaseTaskIf(ControllerId) ;
+        }
+    }
+}
+#endif
+
 
 
 
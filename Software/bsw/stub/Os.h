@@ -1 +1,8 @@
+#ifndef OS_H_
+#define OS_H_
+
+#include "syst.h"
+
 void syst_GetTimeStampus(uint64 * timer);
+
+#endif /* OS_H_ */
@@ -0,0 +1,83 @@
+/*******************************************************************************
+**                                                                            **
+**  Copyright (C) AUTOSarZs olc (2019)		                                  **
+**                                                                            **
+**  All rights reserved.                                                      **
+**                                                                            **
+**  This document contains proprietary information belonging to AUTOSarZs     **
+**  olc . Passing on and copying of this document, and communication          **
+**  of its contents is not permitted without prior written authorization.     **
+**                                                                            **
+********************************************************************************
+**                                                                            **
+**  FILENAME     : SchM_Can.c                                                 **
+**                                                                            **
+**  VERSION      : 1.0.0                                                      **
+**                                                                            **
+**  DATE         : 2019-09-22                                                 **
+**                                                                            **
+**  VARIANT      : Variant PB                                                 **
+**                                                                            **
+**  PLATFORM     : TIVA C		                                              **
+**                                                                            **
+**  AUTHOR       : AUTOSarZs-DevTeam	                                      **
+**                                                                            **
+**  VENDOR       : AUTOSarZs OLC	                                          **
+**                                                                            **
+**                                                                            **
+**  DESCRIPTION  : Exclusive areas of the CAN Driver source file              **
+**                                                                            **
+**  SPECIFICATION(S) : Specification of CAN Driver, AUTOSAR Release 4.3.1     **
+**                                                                            **
+**  MAY BE CHANGED BY USER : no                                               **
+**                                                                            **
+*******************************************************************************/
+
+#include "Std_Types.h"
+#include "core_cm4.h"
+#include "Can_Cfg.h"
+#include "SchM_Can.h"
+
+/* Number of priority bits implemented by the NVIC of the TM4C123 */
+#define SCHM_CAN_PRIO_BITS      (3U)
+
+#if((CAN_IRQ_PRIORITY == 0U) || (CAN_IRQ_PRIORITY >= (1U << SCHM_CAN_PRIO_BITS)))
+  #error "CAN_IRQ_PRIORITY shall be from 1 to 7, priority 0 cannot be masked by BASEPRI"
+#endif
+
+/* BASEPRI value masking the CAN interrupts and the ones with a lower priority */
+#define SCHM_CAN_BASEPRI        (CAN_IRQ_PRIORITY << (8U - SCHM_CAN_PRIO_BITS))
+
+/* Number of exclusive areas entered and not left yet */
+static uint8 SchM_Can_Nesting = 0 ;
+
+/* BASEPRI before the outermost exclusive area was entered */
+static uint32 SchM_Can_SavedBasePri = 0 ;
+
+/*
+ * The nesting state is only used with BASEPRI raised, and no caller at or below
+ * CAN_IRQ_PRIORITY can preempt the owner of an exclusive area
+ */
+void SchM_Enter_Can(void)
+{
+    uint32 BasePri = __get_BASEPRI() ;
+
+    /* BASEPRI is only raised, a caller already masking more interrupts keeps them masked */
+    __set_BASEPRI_MAX(SCHM_CAN_BASEPRI) ;
+    __ISB() ;
+
+    if (0 == SchM_Can_Nesting)
+    {
+        SchM_Can_SavedBasePri = BasePri ;
+    }
+    SchM_Can_Nesting++ ;
+}
+
+void SchM_Exit_Can(void)
+{
+    SchM_Can_Nesting-- ;
+    if (0 == SchM_Can_Nesting)
+    {
+        __set_BASEPRI(SchM_Can_SavedBasePri) ;
+    }
+}
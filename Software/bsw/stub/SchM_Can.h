@@ -1,6 +1,56 @@
+/*******************************************************************************
+**                                                                            **
+**  Copyright (C) AUTOSarZs olc (2019)		                                  **
+**                                                                            **
+**  All rights reserved.                                                      **
+**                                                                            **
+**  This document contains proprietary information belonging to AUTOSarZs     **
+**  olc . Passing on and copying of this document, and communication          **
+**  of its contents is not permitted without prior written authorization.     **
+**                                                                            **
+********************************************************************************
+**                                                                            **
+**  FILENAME     : SchM_Can.h                                                 **
+**                                                                            **
+**  VERSION      : 1.0.0                                                      **
+**                                                                            **
+**  DATE         : 2019-09-22                                                 **
+**                                                                            **
+**  VARIANT      : Variant PB                                                 **
+**                                                                            **
+**  PLATFORM     : TIVA C		                                              **
+**                                                                            **
+**  AUTHOR       : AUTOSarZs-DevTeam	                                      **
+**                                                                            **
+**  VENDOR       : AUTOSarZs OLC	                                          **
+**                                                                            **
+**                                                                            **
+**  DESCRIPTION  : Exclusive areas of the CAN Driver header file              **
+**                                                                            **
+**  SPECIFICATION(S) : Specification of CAN Driver, AUTOSAR Release 4.3.1     **
+**                                                                            **
+**  MAY BE CHANGED BY USER : no                                               **
+**                                                                            **
+*******************************************************************************/
+
 #ifndef SCHM_CAN_H_
 #define SCHM_CAN_H_
 
+/*
+ * The exclusive areas of the CAN Driver only mask the interrupts up to the priority of
+ * the CAN interrupts (CAN_IRQ_PRIORITY) by raising BASEPRI, the interrupts with a higher
+ * priority are never blocked. They nest: BASEPRI is restored when the outermost area is
+ * left. The CAN Driver APIs shall not be called from an interrupt above CAN_IRQ_PRIORITY.
+ */
+void SchM_Enter_Can(void);
+void SchM_Exit_Can(void);
+
+/* Interrupt disable counters and CAN_CTL_IE of the controllers */
+#define SchM_Enter_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS()    SchM_Enter_Can()
+#define SchM_Exit_Can_CAN_EXCLUSIVE_AREA_INTERRUPTS()     SchM_Exit_Can()
 
+/* Software transmit queues of the HTHs */
+#define SchM_Enter_Can_CAN_EXCLUSIVE_AREA_TX_QUEUE()      SchM_Enter_Can()
+#define SchM_Exit_Can_CAN_EXCLUSIVE_AREA_TX_QUEUE()       SchM_Exit_Can()
 
 #endif /* SCHM_CAN_H_ */
@@ -35,6 +35,7 @@
 #include "Std_Types.h"
 #include "ComStack_Types.h"
 #include "CanIf_Cbk.h"
+#include "Can.h"
 
 uint8 ReadData=0;
 Std_ReturnType Det_ReportError(uint16 ModuleId, uint8 InstanceId, uint8 ApiId,
@@ -48,6 +49,16 @@ void CanIf_TxConfirmation(PduIdType CanTxPduId)
 
 }
 
+void CanIf_CancelTxConfirmation(PduIdType CanTxPduId, const PduInfoType * PduInfoPtr)
+{
+
+}
+
+Std_ReturnType CanIf_TriggerTransmit(PduIdType TxPduId, PduInfoType * PduInfoPtr)
+{
+	return E_OK;
+}
+
 void CanIf_ControllerModeIndication( uint8 ControllerId, Can_ControllerStateType ControllerMode )
 {
 
@@ -65,6 +76,34 @@ void CanIf_RxIndication
 
 {
         ReadData= *(PduInfoPtr->SduDataPtr);
+#if(CanRxBufferLoan == STD_ON)
+        Can_ReleaseRxBuffer(PduInfoPtr->SduDataPtr);
+#endif
+}
+
+void CanIf_TxConfirmationTimeStamp(PduIdType CanTxPduId, uint64 TimeStamp)
+{
+        CanIf_TxConfirmation(CanTxPduId);
+}
+
+void CanIf_RxIndicationTimeStamp
+(
+    const Can_HwType * Mailbox,
+    const PduInfoType * PduInfoPtr,
+    uint64 TimeStamp
+)
+{
+        CanIf_RxIndication(Mailbox, PduInfoPtr);
+}
+
+void CanIf_RxIndicationBatch(const Can_RxFrame * Frames, uint8 Count)
+{
+        uint8 index = 0;
+
+        for (index = 0; index < Count; index++)
+        {
+                CanIf_RxIndication(&Frames[index].Mailbox, &Frames[index].PduInfo);
+        }
 }
 
 void CanIf_ControllerBusOff(uint8 ControllerId)
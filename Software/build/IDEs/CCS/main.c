@@ -1,5 +1,8 @@
 
 #include "Can.h"
+/* core_cm4.h is included to use the DWT cycle counter in the benchmarks */
+#include "core_cm4.h"
+#include "can_lib.h"
 
 
 /**
@@ -13,6 +16,8 @@ void PortF_Init(void);
 void Test1_RxTx_Polling(void) ;
 void Test2_TX_2_Objs_RX_2_Objs(void) ;
 void Test3_RxTx_Interrupt(void) ;
+void Test4_Write_Benchmark(void) ;
+void Test5_DataCopy_Benchmark(void) ;
 void irq_Enable(void);
 
 extern uint8 ReadData;
@@ -36,6 +41,25 @@ static Can_PduType  PduInfo[]=
 
 //static uint8 counter=0;
 volatile uint32 SW1=0,SW2=0;
+
+/* Number of frames sent on each HTH by Test4_Write_Benchmark */
+#define BENCH_FRAMES_PER_HTH    (100U)
+
+/* Min/Max/Average CPU cycles spent in Can_write for every HOH handle, read them with the debugger.
+ * Entries of receive handles stay at their initial value */
+volatile uint32 BenchCyclesMin[CAN_HOH_NUMBER];
+volatile uint32 BenchCyclesMax[CAN_HOH_NUMBER];
+volatile uint32 BenchCyclesAvg[CAN_HOH_NUMBER];
+
+/* Number of copies timed for every data length by Test5_DataCopy_Benchmark */
+#define BENCH_COPIES_PER_DLC    (1000U)
+/* IF1 data registers of CAN0 used by Test5_DataCopy_Benchmark */
+#define BENCH_DATA_REGISTERS    ((uint32 *)(0x40040000U + CAN_O_IF1DA1))
+
+/* CPU cycles of one write plus one read of the data registers for every DLC,
+ * with the byte loops used before (Loop) and with CANDataRegSet/Get (Switch) */
+volatile uint32 BenchCopyCyclesLoop[MAX_DATA_LENGTH + 1];
+volatile uint32 BenchCopyCyclesSwitch[MAX_DATA_LENGTH + 1];
 int main(void)
 {
 
@@ -47,13 +71,18 @@ int main(void)
     #if(LOOPBACK==STD_ON)
       CAN0_CTL_R|=0xC0;
       CAN0_TST_R|=0x10;
+      CAN1_CTL_R|=0xC0;
+      CAN1_TST_R|=0x10;
     #endif
-    /*Start Controller 0 */
+    /*Start Controller 0 and Controller 1 */
     Can_SetControllerMode(CONTROLLER0_ID, CAN_CS_STARTED);
+    Can_SetControllerMode(CONTROLLER1_ID, CAN_CS_STARTED);
 
     /*Test*/
    Test3_RxTx_Interrupt();
 //  Test1_RxTx_Polling();
+//  Test4_Write_Benchmark();
+//  Test5_DataCopy_Benchmark();
     return 0;
 }
 
@@ -73,10 +102,24 @@ void Can_Port_Enable(void){
     GPIO_PORTB_AFSEL_R|=0x30 ;
     GPIO_PORTB_PCTL_R&=~0x00FF0000 ;
     GPIO_PORTB_PCTL_R|=0x00880000 ;
+
+    SYSCTL_RCGCGPIO_R|=SYSCTL_RCGCGPIO_R0  ; // port A
+    while(!(SYSCTL_PRGPIO_R &SYSCTL_PRGPIO_R0)){};
+    SYSCTL_RCGCCAN_R|=SYSCTL_RCGCCAN_R1;
+    while(!(SYSCTL_PRCAN_R & SYSCTL_PRCAN_R1)){};
+    GPIO_PORTA_DIR_R|=0x02 ;     // output transmit PA1
+    GPIO_PORTA_DIR_R&=~0x01 ;    // input receive PA0
+    GPIO_PORTA_DEN_R|=0x03 ;
+    GPIO_PORTA_AMSEL_R&=~0x03 ;
+    GPIO_PORTA_AFSEL_R|=0x03 ;
+    GPIO_PORTA_PCTL_R&=~0x000000FF ;
+    GPIO_PORTA_PCTL_R|=0x00000088 ;
     //NVIC Init
      NVIC_PRI9_R  &=~0XFF000000 ;
-     NVIC_PRI9_R  |= 0X20000000 ;  // priority 1
-     NVIC_EN1_R|=0x80;      //Enable CAN0 interrupt
+     NVIC_PRI9_R  |= (CAN_IRQ_PRIORITY << 29) ;  // CAN0 priority, masked by the CAN exclusive areas
+     NVIC_PRI10_R &=~0X000000FF ;
+     NVIC_PRI10_R |= (CAN_IRQ_PRIORITY << 5) ;   // CAN1 priority, the same so they never preempt each other
+     NVIC_EN1_R|=0x180;     //Enable CAN0 and CAN1 interrupts
 }
 
 void PortF_Init(void){
@@ -252,3 +295,143 @@ void Test3_RxTx_Interrupt(void)
 
     }
 }
+
+/*
+ * Measures the CPU cycles spent in Can_write for every configured HTH using the DWT cycle counter.
+ * The HTH configured last is resolved after all the others, so equal results for all the handles
+ * show that the cost per frame does not depend on the number of configured objects.
+ * Build it with CanWriteBenchmarkConfig set to STD_ON in Can_Cfg.h so the 31 HTHs fill the message
+ * objects of CAN0, and run it with LOOPBACK set to STD_ON so every frame leaves its message object
+ * without a bus partner.
+ */
+void Test4_Write_Benchmark(void)
+{
+    Can_HwHandleType Hth;
+    uint16 Frame;
+    uint32 Start;
+    uint32 Cycles;
+    uint32 Sum;
+    Std_ReturnType Ret;
+
+    /* Enable the DWT cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    irq_Enable();
+
+    for(Hth = 0; Hth < CAN_HOH_NUMBER; Hth++)
+    {
+        BenchCyclesMin[Hth] = 0xFFFFFFFFU;
+        BenchCyclesMax[Hth] = 0U;
+        BenchCyclesAvg[Hth] = 0U;
+        Sum = 0U;
+
+        for(Frame = 0; Frame < BENCH_FRAMES_PER_HTH; Frame++)
+        {
+            WriteData1 = (uint8)Frame;
+
+            Start  = DWT->CYCCNT;
+            Ret    = Can_write(Hth, &PduInfo[0]);
+            Cycles = DWT->CYCCNT - Start;
+
+            /* Receive handles are rejected by Can_write, only accepted frames are measured */
+            if(E_OK != Ret)
+            {
+                break;
+            }
+            if(Cycles < BenchCyclesMin[Hth])
+            {
+                BenchCyclesMin[Hth] = Cycles;
+            }
+            if(Cycles > BenchCyclesMax[Hth])
+            {
+                BenchCyclesMax[Hth] = Cycles;
+            }
+            Sum += Cycles;
+
+            /* Wait until the frame is sent so every call takes the same path */
+            while((CAN0_TXRQ1_R != 0) || (CAN0_TXRQ2_R != 0) ||
+                  (CAN1_TXRQ1_R != 0) || (CAN1_TXRQ2_R != 0))
+            {
+                Can_MainFunction_Write();
+            }
+        }
+        if(Frame != 0U)
+        {
+            BenchCyclesAvg[Hth] = Sum / Frame;
+        }
+    }
+
+    while(1)
+    {
+    }
+}
+
+/* Byte loops used by the driver before CANDataRegSet/Get, kept as the reference */
+static void BenchLoopDataRegWrite(uint8 *pui8Data, uint32 *pui32Register, uint32 ui32Size)
+{
+    uint32 ui32Idx, ui32Value;
+
+    for(ui32Idx = 0; ui32Idx < ui32Size; )
+    {
+        ui32Value = pui8Data[ui32Idx++];
+        if(ui32Idx < ui32Size)
+        {
+            ui32Value |= (pui8Data[ui32Idx++] << 8);
+        }
+        HWREG(pui32Register++) = ui32Value;
+    }
+}
+
+static void BenchLoopDataRegRead(uint8 *pui8Data, uint32 *pui32Register, uint32 ui32Size)
+{
+    uint32 ui32Idx, ui32Value;
+
+    for(ui32Idx = 0; ui32Idx < ui32Size; )
+    {
+        ui32Value = HWREG(pui32Register++);
+        pui8Data[ui32Idx++] = (uint8)ui32Value;
+        if(ui32Idx < ui32Size)
+        {
+            pui8Data[ui32Idx++] = (uint8)(ui32Value >> 8);
+        }
+    }
+}
+
+void Test5_DataCopy_Benchmark(void)
+{
+    uint8 TxData[MAX_DATA_LENGTH] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8 RxData[MAX_DATA_LENGTH];
+    uint32 Dlc;
+    uint32 Copy;
+    uint32 Start;
+
+    /* Enable the DWT cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    for(Dlc = 0; Dlc <= MAX_DATA_LENGTH; Dlc++)
+    {
+        Start = DWT->CYCCNT;
+        for(Copy = 0; Copy < BENCH_COPIES_PER_DLC; Copy++)
+        {
+            BenchLoopDataRegWrite(TxData, BENCH_DATA_REGISTERS, Dlc);
+            BenchLoopDataRegRead(RxData, BENCH_DATA_REGISTERS, Dlc);
+        }
+        BenchCopyCyclesLoop[Dlc] = (DWT->CYCCNT - Start) / BENCH_COPIES_PER_DLC;
+
+        Start = DWT->CYCCNT;
+        for(Copy = 0; Copy < BENCH_COPIES_PER_DLC; Copy++)
+        {
+            CANDataRegSet(TxData, BENCH_DATA_REGISTERS, Dlc);
+            CANDataRegGet(RxData, BENCH_DATA_REGISTERS, Dlc);
+        }
+        BenchCopyCyclesSwitch[Dlc] = (DWT->CYCCNT - Start) / BENCH_COPIES_PER_DLC;
+    }
+
+    while(1)
+    {
+    }
+}
@@ -0,0 +1,148 @@
+/*
+ * Host check of the CAN data register copies of can_lib.h.
+ *
+ * CANDataRegSet/CANDataRegGet are built for the host and run on a plain memory
+ * array standing for the IF1 data registers. For every DLC from 0 to 8 they are
+ * compared with the byte loops the driver used before (kept below as the
+ * reference): same register contents after a write, same buffer contents after
+ * a read. Both are then timed on a mixed DLC load.
+ *
+ * Build and run from the root of the repository:
+ *
+ *   I=Software/bsw/static/Infrastructure/platform/inc
+ *   gcc -O2 -std=gnu99 -I$I -ISoftware/bsw/static/Infrastructure/inc \
+ *       Tools/can_data_copy_bench.c -o can_data_copy_bench
+ *   ./can_data_copy_bench
+ *
+ * The exit status is 1 when a copy differs from the reference. The times are
+ * those of the host, both copies are inlined here as they are in the driver.
+ * The cycles on the TM4C123 are measured by Test5_DataCopy_Benchmark of the CCS
+ * application.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "Std_Types.h"
+#include "can_lib.h"
+
+/* Copies of every DLC in one timed run */
+#define BENCH_COPIES        (20000000UL)
+
+/* Register words of the IF1 data registers DA1, DA2, DB1, DB2 */
+#define BENCH_REGISTERS     (4U)
+
+/* Byte loops used by the driver before CANDataRegSet/Get, kept as the reference */
+static void LoopDataRegWrite(uint8 *pui8Data, uint32 *pui32Register, uint32 ui32Size)
+{
+    uint32 ui32Idx, ui32Value;
+
+    for(ui32Idx = 0; ui32Idx < ui32Size; )
+    {
+        ui32Value = pui8Data[ui32Idx++];
+        if(ui32Idx < ui32Size)
+        {
+            ui32Value |= (pui8Data[ui32Idx++] << 8);
+        }
+        *(volatile uint32 *)(pui32Register++) = ui32Value;
+    }
+}
+
+static void LoopDataRegRead(uint8 *pui8Data, uint32 *pui32Register, uint32 ui32Size)
+{
+    uint32 ui32Idx, ui32Value;
+
+    for(ui32Idx = 0; ui32Idx < ui32Size; )
+    {
+        ui32Value = *(volatile uint32 *)(pui32Register++);
+        pui8Data[ui32Idx++] = (uint8)ui32Value;
+        if(ui32Idx < ui32Size)
+        {
+            pui8Data[ui32Idx++] = (uint8)(ui32Value >> 8);
+        }
+    }
+}
+
+static double Seconds(void)
+{
+    struct timespec Now;
+
+    clock_gettime(CLOCK_MONOTONIC, &Now);
+    return (double)Now.tv_sec + (double)Now.tv_nsec * 1e-9;
+}
+
+static int CheckDlc(uint32 Dlc)
+{
+    uint8  TxData[8] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+    uint32 RegLoop[BENCH_REGISTERS];
+    uint32 RegSwitch[BENCH_REGISTERS];
+    uint8  RxLoop[8];
+    uint8  RxSwitch[8];
+
+    /* The registers above the DLC keep their value, the buffer bytes above it too */
+    memset(RegLoop, 0xA5, sizeof(RegLoop));
+    memset(RegSwitch, 0xA5, sizeof(RegSwitch));
+    LoopDataRegWrite(TxData, RegLoop, Dlc);
+    CANDataRegSet(TxData, RegSwitch, Dlc);
+    if(0 != memcmp(RegLoop, RegSwitch, sizeof(RegLoop)))
+    {
+        printf("DLC %lu: CANDataRegSet differs from the byte loop\n", (unsigned long)Dlc);
+        return 1;
+    }
+
+    memset(RxLoop, 0x5A, sizeof(RxLoop));
+    memset(RxSwitch, 0x5A, sizeof(RxSwitch));
+    LoopDataRegRead(RxLoop, RegLoop, Dlc);
+    CANDataRegGet(RxSwitch, RegSwitch, Dlc);
+    if(0 != memcmp(RxLoop, RxSwitch, sizeof(RxLoop)))
+    {
+        printf("DLC %lu: CANDataRegGet differs from the byte loop\n", (unsigned long)Dlc);
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    uint8  TxData[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8  RxData[8];
+    uint32 Registers[BENCH_REGISTERS];
+    uint32 Dlc;
+    uint32 Copy;
+    int    Errors = 0;
+    double Start;
+    double Loop;
+    double Switch;
+
+    for(Dlc = 0; Dlc <= 8; Dlc++)
+    {
+        Errors += CheckDlc(Dlc);
+    }
+    printf("DLC 0..8: %s\n", (0 == Errors) ? "CANDataRegSet/Get match the byte loops" : "MISMATCH");
+
+    /* One write and one read per copy, the DLC cycles through 0..8 */
+    Start = Seconds();
+    for(Copy = 0; Copy < BENCH_COPIES; Copy++)
+    {
+        Dlc = Copy % 9U;
+        LoopDataRegWrite(TxData, Registers, Dlc);
+        LoopDataRegRead(RxData, Registers, Dlc);
+    }
+    Loop = Seconds() - Start;
+
+    Start = Seconds();
+    for(Copy = 0; Copy < BENCH_COPIES; Copy++)
+    {
+        Dlc = Copy % 9U;
+        CANDataRegSet(TxData, Registers, Dlc);
+        CANDataRegGet(RxData, Registers, Dlc);
+    }
+    Switch = Seconds() - Start;
+
+    printf("mixed DLC, %lu copies: byte loops %.1f ns, CANDataRegSet/Get %.1f ns per copy, %.2fx\n",
+           (unsigned long)BENCH_COPIES, Loop * 1e9 / BENCH_COPIES, Switch * 1e9 / BENCH_COPIES,
+           Loop / Switch);
+
+    return (0 == Errors) ? 0 : 1;
+}
@@ -0,0 +1,284 @@
+#!/usr/bin/env python3
+"""
+CAN receive filter optimizer for the TM4C123 Can driver.
+
+Packs the CAN IDs an ECU has to receive into the code/mask hardware filters
+of the 32 message objects of one controller, and emits the CanHwFilter,
+CanSwFilter and CanHardwareObject tables of Can_PBcfg.c.
+
+Input file, one ID per line, '#' starts a comment:
+
+    <id> <latency class> [ext]
+
+    0x100 fast          11-bit ID with its own Full-CAN message object
+    0x2A0 normal        11-bit ID, may share a Basic-CAN filter
+    0x18FF0010 normal   29-bit ID (any ID above 0x7FF, or marked ext)
+
+'fast' IDs always get an exact filter. 'normal' IDs start with one exact
+filter each, then the two filters whose merge lets through the least
+unwanted traffic are merged until the filters fit in the message objects
+left by the transmit objects. With --max-false-accept, merging goes on
+while the false-accept rate stays below the given value, to free objects.
+A merge is never done when the merged filter would also pass a wanted ID of
+another filter: the lowest message object matching a frame takes it, and the
+software filter of that HRH only accepts its own IDs, so the frame would be
+dropped.
+
+Unwanted traffic is the set of IDs given with --bus (lines "<id> [frames/s]"),
+or the whole ID space when no bus file is given.
+
+Usage:
+    can_filter_optimizer.py rx_ids.txt [--bus bus.txt] [--tx-objects 2]
+                            [--fifo-depth 1] [--max-false-accept 0.0]
+                            [--max-dlc 8] [--controller 0] [--first-hoh 0]
+                            [-o Can_RxFilters.c]
+"""
+
+import argparse
+import sys
+
+STD_BITS = 11
+EXT_BITS = 29
+MESSAGE_OBJECTS = 32
+
+
+class Filter(object):
+    """One code/mask hardware filter and the wanted IDs it receives."""
+
+    def __init__(self, ids, ext, fast):
+        self.ids = sorted(ids)
+        self.ext = ext
+        self.fast = fast
+        width = (1 << (EXT_BITS if ext else STD_BITS)) - 1
+        # Bits where all IDs agree must match (mask bit 1), the others are don't care
+        same = width
+        for can_id in self.ids:
+            same &= ~(can_id ^ self.ids[0])
+        self.mask = same & width
+        self.code = self.ids[0] & self.mask
+        self.width = width
+
+    def accepts(self, can_id):
+        return (can_id & self.mask) == self.code
+
+    def space(self):
+        """Number of IDs passing the filter."""
+        return 1 << bin(self.width & ~self.mask).count("1")
+
+
+def parse_id(text):
+    return int(text, 0)
+
+
+def read_rx_ids(path):
+    wanted = []
+    with open(path) as stream:
+        for number, line in enumerate(stream, 1):
+            fields = line.split("#", 1)[0].split()
+            if not fields:
+                continue
+            if len(fields) < 2 or fields[1] not in ("fast", "normal"):
+                sys.exit("%s:%d: expected '<id> fast|normal [ext]'" % (path, number))
+            can_id = parse_id(fields[0])
+            ext = (len(fields) > 2 and fields[2] == "ext") or can_id > 0x7FF
+            if can_id >= (1 << EXT_BITS):
+                sys.exit("%s:%d: ID 0x%X is not a 29-bit ID" % (path, number, can_id))
+            wanted.append((can_id, ext, fields[1] == "fast"))
+    return wanted
+
+
+def read_bus(path):
+    bus = {}
+    with open(path) as stream:
+        for line in stream:
+            fields = line.split("#", 1)[0].split()
+            if fields:
+                bus[parse_id(fields[0])] = float(fields[1]) if len(fields) > 1 else 1.0
+    return bus
+
+
+class Cost(object):
+    """False-accept cost of a filter: unwanted frames/s, or unwanted ID space."""
+
+    def __init__(self, wanted, bus):
+        self.wanted = set((can_id, ext) for can_id, ext, _ in wanted)
+        self.bus = bus
+        if bus:
+            self.total = sum(rate for can_id, rate in bus.items()
+                             if (can_id, can_id > 0x7FF) not in self.wanted) or 1.0
+
+    def of(self, flt):
+        if self.bus:
+            return sum(rate for can_id, rate in self.bus.items()
+                       if (can_id > 0x7FF) == flt.ext and flt.accepts(can_id)
+                       and (can_id, flt.ext) not in self.wanted)
+        return flt.space() - len(flt.ids)
+
+    def rate(self, filters):
+        """False-accept rate of a filter set, overlapping filters counted once."""
+        if self.bus:
+            lost = sum(rate for can_id, rate in self.bus.items()
+                       if (can_id, can_id > 0x7FF) not in self.wanted
+                       and any(f.ext == (can_id > 0x7FF) and f.accepts(can_id) for f in filters))
+            return lost / self.total
+        std = sum(self.of(f) for f in filters if not f.ext) / float(1 << STD_BITS)
+        ext = sum(self.of(f) for f in filters if f.ext) / float(1 << EXT_BITS)
+        return std + ext
+
+
+def steals(flt, wanted):
+    """True when the filter passes a wanted ID it does not own."""
+    own = set(flt.ids)
+    return any(ext == flt.ext and can_id not in own and flt.accepts(can_id)
+               for can_id, ext, _ in wanted)
+
+
+def optimize(wanted, cost, budget, max_false_accept):
+    fast = [Filter([can_id], ext, True) for can_id, ext, is_fast in wanted if is_fast]
+    merged = [Filter([can_id], ext, False) for can_id, ext, is_fast in wanted if not is_fast]
+    if len(fast) > budget:
+        sys.exit("%d fast IDs do not fit in %d message objects" % (len(fast), budget))
+
+    while len(merged) > 1:
+        best = None
+        for i in range(len(merged)):
+            for j in range(i + 1, len(merged)):
+                if merged[i].ext != merged[j].ext:
+                    continue
+                candidate = Filter(merged[i].ids + merged[j].ids, merged[i].ext, False)
+                if steals(candidate, wanted):
+                    continue
+                increase = cost.of(candidate) - cost.of(merged[i]) - cost.of(merged[j])
+                if best is None or increase < best[0]:
+                    best = (increase, i, j, candidate)
+        if best is None:
+            break
+        fits = len(fast) + len(merged) <= budget
+        if fits:
+            trial = fast + [f for k, f in enumerate(merged) if k not in (best[1], best[2])] + [best[3]]
+            if cost.rate(trial) > max_false_accept:
+                break
+        del merged[best[2]]
+        del merged[best[1]]
+        merged.append(best[3])
+
+    filters = fast + sorted(merged, key=lambda f: (f.ext, f.code))
+    if len(filters) > budget:
+        sys.exit("%d filters do not fit in %d message objects, 11-bit and 29-bit IDs "
+                 "never share a filter" % (len(filters), budget))
+    return filters
+
+
+def emit(filters, args, cost, out):
+    ctrl = args.controller
+    write = out.write
+    write("/* Generated by Tools/can_filter_optimizer.py, expected false-accept rate %.6f */\n\n"
+          % cost.rate(filters))
+
+    for index, flt in enumerate(filters):
+        if flt.fast or flt.ext:
+            continue
+        words = [0] * ((1 << STD_BITS) // 32)
+        for can_id in flt.ids:
+            words[can_id >> 5] |= 1 << (can_id & 31)
+        write("const uint32 CanSwFilterStdBitmapHRH%d_%d[2048 / 32] =\n{\n" % (ctrl, index))
+        write(",\n".join("    [%d] = 0x%08XUL" % (k, w) for k, w in enumerate(words) if w))
+        write("\n};\n\n")
+    for index, flt in enumerate(filters):
+        if flt.ext and not flt.fast:
+            write("const uint32 CanSwFilterExtIdsHRH%d_%d[] =\n{\n    %s\n};\n\n"
+                  % (ctrl, index, ",\n    ".join("0x%08XUL" % i for i in flt.ids)))
+
+    write("const CanSwFilter CanSwFilterHRH[] =\n{\n")
+    entries = []
+    for index, flt in enumerate(filters):
+        if flt.fast:
+            continue
+        if flt.ext:
+            entries.append("    {\n        NULL_PTR,\n        CanSwFilterExtIdsHRH%d_%d,\n        %d\n    }"
+                           % (ctrl, index, len(flt.ids)))
+        else:
+            entries.append("    {\n        CanSwFilterStdBitmapHRH%d_%d,\n        NULL_PTR,\n        0\n    }"
+                           % (ctrl, index))
+    write(",\n".join(entries) + "\n};\n\n")
+
+    write("CanHwFilter CanHwFilterHRH[] =\n{\n")
+    write(",\n".join("    {\n        0x%X,%s/*  ID  */\n        0x%X%s/*  Mask filter */\n    }"
+                     % (f.code, " " * max(1, 18 - len("0x%X," % f.code)),
+                        f.mask, " " * max(1, 19 - len("0x%X" % f.mask)))
+                     for f in filters))
+    write("\n};\n\n")
+
+    write("/* HRH entries of HOHObj[] */\n")
+    sw_index = 0
+    for index, flt in enumerate(filters):
+        if flt.fast:
+            sw_ref = "NULL_PTR"
+        else:
+            sw_ref = "&CanSwFilterHRH[%d]" % sw_index
+            sw_index += 1
+        write("    {\n")
+        write("        %-24s /*  Can controller type for tm4c123gh6pm    */\n"
+              % ("FULL," if len(flt.ids) == 1 else "BASIC,"))
+        write("        %-24s /*  Number of FIFO elements for this HOH    */\n"
+              % ("%d," % (1 if flt.fast else args.fifo_depth)))
+        write("        %-24s /*  Arbitration ID type */\n" % ("EXTENDED," if flt.ext else "STANDARD,"))
+        write("        %-24s /*  HOH ID  */\n" % ("%d," % (args.first_hoh + index)))
+        write("        %-24s /*  HOH Type    */\n" % "RECEIVE,")
+        write("        %-24s /*  Reference to the controller this HOH belongs to */\n"
+              % ("&CanControllerCfg[%d]," % ctrl))
+        write("        %-24s /*  Reference to the Filter configuartion   */\n"
+              % ("&CanHwFilterHRH[%d]," % index))
+        write("        %-24s /*  Enable or diasble using polling */\n"
+              % ("FALSE," if flt.fast else "%s," % ("TRUE" if args.poll_normal else "FALSE")))
+        write("        %-24s /*  Reference to the software acceptance filter */\n" % (sw_ref + ","))
+        write("        %-24s /*  Largest DLC received */\n" % ("%d" % args.max_dlc))
+        write("    },\n")
+
+
+def report(filters, cost, budget, args):
+    used = sum(1 if f.fast else args.fifo_depth for f in filters)
+    sys.stderr.write("HRH  type  code        mask        IDs  false accepts\n")
+    for index, flt in enumerate(filters):
+        sys.stderr.write("%3d  %-5s 0x%08X  0x%08X  %3d  %g\n"
+                         % (index, "fast" if flt.fast else ("ext" if flt.ext else "std"),
+                            flt.code, flt.mask, len(flt.ids), cost.of(flt)))
+    sys.stderr.write("%d of %d receive message objects used, expected false-accept rate %.6f %s\n"
+                     % (used, budget, cost.rate(filters),
+                        "of the unwanted bus traffic" if args.bus else "of the unwanted ID space"))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("rx_ids", help="IDs to receive with their latency class")
+    parser.add_argument("--bus", help="IDs seen on the bus, with their frames/s")
+    parser.add_argument("--tx-objects", type=int, default=2, help="message objects used by the HTHs")
+    parser.add_argument("--fifo-depth", type=int, default=1, help="message objects per Basic-CAN HRH")
+    parser.add_argument("--max-false-accept", type=float, default=0.0,
+                        help="keep merging filters while the false-accept rate stays below this")
+    parser.add_argument("--poll-normal", action="store_true", help="poll the Basic-CAN HRHs")
+    parser.add_argument("--max-dlc", type=int, default=8, choices=range(1, 9),
+                        help="largest DLC received by the HRHs, 4 or less skips data bytes 4 to 7")
+    parser.add_argument("--controller", type=int, default=0)
+    parser.add_argument("--first-hoh", type=int, default=0, help="handle of the first HRH")
+    parser.add_argument("-o", "--output", help="C file to write, stdout by default")
+    args = parser.parse_args()
+
+    wanted = read_rx_ids(args.rx_ids)
+    cost = Cost(wanted, read_bus(args.bus) if args.bus else None)
+
+    # Fast IDs take one object each, a Basic-CAN HRH takes fifo-depth objects
+    objects = MESSAGE_OBJECTS - args.tx_objects
+    fast_count = sum(1 for _, _, is_fast in wanted if is_fast)
+    budget = fast_count + (objects - fast_count) // max(1, args.fifo_depth)
+    filters = optimize(wanted, cost, budget, args.max_false_accept)
+
+    out = open(args.output, "w") if args.output else sys.stdout
+    emit(filters, args, cost, out)
+    if args.output:
+        out.close()
+    report(filters, cost, objects, args)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,726 @@
+/* Generated by Tools/can_filter_optimizer.py, expected false-accept rate 0.043945 */
+
+const uint32 CanSwFilterStdBitmapHRH0_3[2048 / 32] =
+{
+    [1] = 0x10000000UL,
+    [3] = 0x00001000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_4[2048 / 32] =
+{
+    [1] = 0x00080000UL,
+    [9] = 0x02000000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_5[2048 / 32] =
+{
+    [6] = 0x20000000UL,
+    [10] = 0x20000000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_6[2048 / 32] =
+{
+    [3] = 0x00000002UL,
+    [7] = 0x00000200UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_7[2048 / 32] =
+{
+    [6] = 0x01000001UL,
+    [14] = 0x00010000UL,
+    [22] = 0x01000000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_8[2048 / 32] =
+{
+    [8] = 0x00000020UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_9[2048 / 32] =
+{
+    [10] = 0x00000800UL,
+    [46] = 0x00000008UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_10[2048 / 32] =
+{
+    [18] = 0x08020000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_11[2048 / 32] =
+{
+    [31] = 0x20000000UL,
+    [51] = 0x20000000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_12[2048 / 32] =
+{
+    [21] = 0x00000800UL,
+    [52] = 0x00000800UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_13[2048 / 32] =
+{
+    [20] = 0x00800000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_14[2048 / 32] =
+{
+    [28] = 0x14000000UL,
+    [29] = 0x01000000UL,
+    [61] = 0x01000000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_15[2048 / 32] =
+{
+    [29] = 0x00000010UL,
+    [61] = 0x00000440UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_16[2048 / 32] =
+{
+    [37] = 0x00000200UL,
+    [41] = 0x00002000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_17[2048 / 32] =
+{
+    [34] = 0x80000000UL,
+    [58] = 0x80000000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_18[2048 / 32] =
+{
+    [37] = 0x20800000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_19[2048 / 32] =
+{
+    [39] = 0x00080000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_20[2048 / 32] =
+{
+    [47] = 0x00000020UL,
+    [59] = 0x00000020UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_21[2048 / 32] =
+{
+    [44] = 0x00200000UL,
+    [46] = 0xA0000000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_22[2048 / 32] =
+{
+    [46] = 0x01000100UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_23[2048 / 32] =
+{
+    [48] = 0x00000008UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_24[2048 / 32] =
+{
+    [48] = 0x10000000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_25[2048 / 32] =
+{
+    [51] = 0x00040002UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_26[2048 / 32] =
+{
+    [54] = 0x00004000UL
+};
+
+const uint32 CanSwFilterStdBitmapHRH0_27[2048 / 32] =
+{
+    [61] = 0x80000000UL,
+    [63] = 0x40000000UL
+};
+
+const CanSwFilter CanSwFilterHRH[] =
+{
+    {
+        CanSwFilterStdBitmapHRH0_3,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_4,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_5,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_6,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_7,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_8,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_9,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_10,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_11,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_12,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_13,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_14,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_15,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_16,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_17,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_18,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_19,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_20,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_21,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_22,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_23,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_24,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_25,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_26,
+        NULL_PTR,
+        0
+    },
+    {
+        CanSwFilterStdBitmapHRH0_27,
+        NULL_PTR,
+        0
+    }
+};
+
+CanHwFilter CanHwFilterHRH[] =
+{
+    {
+        0x30E,            /*  ID  */
+        0x7FF              /*  Mask filter */
+    },
+    {
+        0x51,             /*  ID  */
+        0x7FF              /*  Mask filter */
+    },
+    {
+        0x46C,            /*  ID  */
+        0x7FF              /*  Mask filter */
+    },
+    {
+        0x2C,             /*  ID  */
+        0x7AF              /*  Mask filter */
+    },
+    {
+        0x31,             /*  ID  */
+        0x6F5              /*  Mask filter */
+    },
+    {
+        0x5D,             /*  ID  */
+        0x67F              /*  Mask filter */
+    },
+    {
+        0x61,             /*  ID  */
+        0x777              /*  Mask filter */
+    },
+    {
+        0xC0,             /*  ID  */
+        0x4E7              /*  Mask filter */
+    },
+    {
+        0x105,            /*  ID  */
+        0x7FF              /*  Mask filter */
+    },
+    {
+        0x143,            /*  ID  */
+        0x377              /*  Mask filter */
+    },
+    {
+        0x251,            /*  ID  */
+        0x7F5              /*  Mask filter */
+    },
+    {
+        0x27D,            /*  ID  */
+        0x27F              /*  Mask filter */
+    },
+    {
+        0x28B,            /*  ID  */
+        0x3DF              /*  Mask filter */
+    },
+    {
+        0x297,            /*  ID  */
+        0x7FF              /*  Mask filter */
+    },
+    {
+        0x398,            /*  ID  */
+        0x3D9              /*  Mask filter */
+    },
+    {
+        0x3A0,            /*  ID  */
+        0x3F1              /*  Mask filter */
+    },
+    {
+        0x429,            /*  ID  */
+        0x67B              /*  Mask filter */
+    },
+    {
+        0x45F,            /*  ID  */
+        0x4FF              /*  Mask filter */
+    },
+    {
+        0x4B5,            /*  ID  */
+        0x7F5              /*  Mask filter */
+    },
+    {
+        0x4F3,            /*  ID  */
+        0x7FF              /*  Mask filter */
+    },
+    {
+        0x565,            /*  ID  */
+        0x57F              /*  Mask filter */
+    },
+    {
+        0x595,            /*  ID  */
+        0x7B5              /*  Mask filter */
+    },
+    {
+        0x5C8,            /*  ID  */
+        0x7EF              /*  Mask filter */
+    },
+    {
+        0x603,            /*  ID  */
+        0x7FF              /*  Mask filter */
+    },
+    {
+        0x61C,            /*  ID  */
+        0x7FF              /*  Mask filter */
+    },
+    {
+        0x660,            /*  ID  */
+        0x7EC              /*  Mask filter */
+    },
+    {
+        0x6CE,            /*  ID  */
+        0x7FF              /*  Mask filter */
+    },
+    {
+        0x7BE,            /*  ID  */
+        0x7BE              /*  Mask filter */
+    }
+};
+
+/* HRH entries of HOHObj[] */
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        0,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[0],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        NULL_PTR,                /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        1,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[1],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        NULL_PTR,                /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        2,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[2],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        NULL_PTR,                /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        3,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[3],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[0],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        4,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[4],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[1],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        5,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[5],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[2],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        6,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[6],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[3],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        7,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[7],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[4],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        8,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[8],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[5],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        9,                       /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[9],      /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[6],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        10,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[10],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[7],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        11,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[11],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[8],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        12,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[12],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[9],      /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        13,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[13],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[10],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        14,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[14],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[11],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        15,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[15],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[12],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        16,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[16],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[13],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        17,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[17],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[14],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        18,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[18],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[15],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        19,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[19],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[16],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        20,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[20],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[17],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        21,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[21],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[18],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        22,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[22],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[19],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        23,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[23],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[20],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        24,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[24],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[21],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        25,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[25],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[22],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        FULL,                    /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        26,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[26],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[23],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },
+    {
+        BASIC,                   /*  Can controller type for tm4c123gh6pm    */
+        1,                       /*  Number of FIFO elements for this HOH    */
+        STANDARD,                /*  Arbitration ID type */
+        27,                      /*  HOH ID  */
+        RECEIVE,                 /*  HOH Type    */
+        &CanControllerCfg[0],    /*  Reference to the controller this HOH belongs to */
+        &CanHwFilterHRH[27],     /*  Reference to the Filter configuartion   */
+        FALSE,                   /*  Enable or diasble using polling */
+        &CanSwFilterHRH[24],     /*  Reference to the software acceptance filter */
+        8                        /*  Largest DLC received */
+    },